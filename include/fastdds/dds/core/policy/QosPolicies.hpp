@@ -2759,6 +2759,7 @@ public:
                (this->use_builtin_transports == b.use_builtin_transports) &&
                (this->send_socket_buffer_size == b.send_socket_buffer_size) &&
                (this->listen_socket_buffer_size == b.listen_socket_buffer_size) &&
+               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads) &&
                QosPolicy::operator ==(b);
     }
 
@@ -2784,6 +2785,9 @@ public:
      * By default, 0.
      */
     uint32_t listen_socket_buffer_size;
+
+    //! Thread settings for the builtin transports reception threads
+    fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
 };
 
 //! Qos Policy to configure the endpoint
@@ -24,6 +24,7 @@
 
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
 
 namespace eprosima {
@@ -81,7 +82,11 @@ public:
                (this->wire_protocol_ == b.wire_protocol()) &&
                (this->transport_ == b.transport()) &&
                (this->name_ == b.name()) &&
-               (this->flow_controllers_ == b.flow_controllers());
+               (this->flow_controllers_ == b.flow_controllers()) &&
+               (this->timed_events_thread_ == b.timed_events_thread()) &&
+               (this->discovery_server_thread_ == b.discovery_server_thread()) &&
+               (this->builtin_controllers_sender_thread_ == b.builtin_controllers_sender_thread()) &&
+               (this->data_sharing_listener_thread_ == b.data_sharing_listener_thread());
     }
 
     /**
@@ -321,6 +326,130 @@ public:
         return flow_controllers_;
     }
 
+    /**
+     * Getter for timed event ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& timed_events_thread()
+    {
+        return timed_events_thread_;
+    }
+
+    /**
+     * Getter for timed event ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& timed_events_thread() const
+    {
+        return timed_events_thread_;
+    }
+
+    /**
+     * Setter for the timed event ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void timed_events_thread(
+            const rtps::ThreadSettings& value)
+    {
+        timed_events_thread_ = value;
+    }
+
+    /**
+     * Getter for discovery server ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& discovery_server_thread()
+    {
+        return discovery_server_thread_;
+    }
+
+    /**
+     * Getter for discovery server ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& discovery_server_thread() const
+    {
+        return discovery_server_thread_;
+    }
+
+    /**
+     * Setter for the discovery server ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void discovery_server_thread(
+            const rtps::ThreadSettings& value)
+    {
+        discovery_server_thread_ = value;
+    }
+
+    /**
+     * Getter for builtin flow controllers sender threads ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& builtin_controllers_sender_thread()
+    {
+        return builtin_controllers_sender_thread_;
+    }
+
+    /**
+     * Getter for builtin flow controllers sender threads ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& builtin_controllers_sender_thread() const
+    {
+        return builtin_controllers_sender_thread_;
+    }
+
+    /**
+     * Setter for the builtin flow controllers sender threads ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void builtin_controllers_sender_thread(
+            const rtps::ThreadSettings& value)
+    {
+        builtin_controllers_sender_thread_ = value;
+    }
+
+    /**
+     * Getter for data-sharing listener ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& data_sharing_listener_thread()
+    {
+        return data_sharing_listener_thread_;
+    }
+
+    /**
+     * Getter for data-sharing listener ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& data_sharing_listener_thread() const
+    {
+        return data_sharing_listener_thread_;
+    }
+
+    /**
+     * Setter for the data-sharing listener ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void data_sharing_listener_thread(
+            const rtps::ThreadSettings& value)
+    {
+        data_sharing_listener_thread_ = value;
+    }
+
 private:
 
     //!UserData Qos, implemented in the library.
@@ -350,6 +479,18 @@ private:
      */
     FlowControllerDescriptorList flow_controllers_;
 
+    //! Thread settings for the timed events thread
+    rtps::ThreadSettings timed_events_thread_;
+
+    //! Thread settings for the discovery server thread
+    rtps::ThreadSettings discovery_server_thread_;
+
+    //! Thread settings for the sender threads of the builtin asynchronous flow controllers
+    rtps::ThreadSettings builtin_controllers_sender_thread_;
+
+    //! Thread settings for the data-sharing listener thread of each reader
+    rtps::ThreadSettings data_sharing_listener_thread_;
+
 };
 
 RTPS_DllAPI extern const DomainParticipantQos PARTICIPANT_QOS_DEFAULT;
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_DDS_LOG_LOG_HPP_
 #define _FASTDDS_DDS_LOG_LOG_HPP_
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastrtps/fastrtps_dll.h>
 #include <thread>
 #include <sstream>
@@ -140,6 +141,13 @@ public:
     //! Stops the logging thread. It will re-launch on the next call to a successful log macro.
     RTPS_DllAPI static void KillThread();
 
+    /**
+     * Sets the settings applied to the logging thread.
+     * They take effect the next time the logging thread is launched, so they should be set before logging anything.
+     */
+    RTPS_DllAPI static void SetThreadConfig(
+            const rtps::ThreadSettings&);
+
     // Note: In VS2013, if you're linking this class statically, you will have to call KillThread before leaving
     // main, due to an unsolved MSVC bug.
 
@@ -43,6 +43,7 @@ namespace rtps {
 
 class WriteParams;
 struct GUID_t;
+struct SerializedPayload_t;
 
 } // namespace rtps
 } // namespace fastrtps
@@ -56,6 +57,7 @@ class Publisher;
 
 class TypeSupport;
 
+class DataReader;
 class DataWriterImpl;
 class DataWriterListener;
 class DataWriterQos;
@@ -196,6 +198,62 @@ public:
             const fastrtps::rtps::Time_t& timestamp);
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
+    /**
+     * Write a batch of samples to the topic.
+     *
+     * All the samples are added to the history under a single lock of the DataWriter, and the identity of the
+     * instance of each one is automatically deduced from its key, as when calling @ref write with HANDLE_NIL.
+     * Samples sent synchronously are packed together on the same RTPS messages, reducing the number of datagrams
+     * needed for a burst of small samples. While a batch is being written, samples written from other threads, and
+     * other batches, are sent as usual. Samples are written in order, and the operation stops on the first sample
+     * that cannot be written; the previous ones remain written.
+     *
+     * @param data Pointers to the samples to write.
+     * @return RETCODE_OK if all the samples are correctly written, the return code of the first sample that could not
+     * be written otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t write_batch(
+            const std::vector<void*>& data);
+
+    /**
+     * Write an already serialized sample to the topic.
+     *
+     * The serialized sample is copied into the payload pool of the DataWriter, and published without being
+     * deserialized.
+     * The special value HANDLE_NIL can be used for the parameter handle. On keyed topics, this indicates that the
+     * identity of the instance should be deduced from the key, which requires deserializing the sample.
+     * Any other handle is trusted to be the instance of the sample, and is only checked against its key on debug
+     * builds, where a mismatch returns RETCODE_PRECONDITION_NOT_MET.
+     *
+     * @param payload Serialized sample, including its encapsulation.
+     * @param handle InstanceHandle_t of the instance the sample belongs to.
+     * @return RETCODE_OK if the sample is correctly written, any of the standard return codes otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t write_serialized(
+            const fastrtps::rtps::SerializedPayload_t& payload,
+            const InstanceHandle_t& handle = HANDLE_NIL);
+
+    /**
+     * Forward a serialized sample loaned by a DataReader.
+     *
+     * This operation behaves as @ref write_serialized, but when @c payload has been loaned by @c reader through
+     * DataReader::read_serialized or DataReader::take_serialized, the DataWriter shares the buffer of the reader's
+     * payload pool instead of copying it. Forwarding the same sample through several DataWriters keeps a single
+     * copy of it, which is released once the loan has been returned and all DataWriters have removed it from their
+     * histories.
+     * Payloads that cannot be shared (e.g. received through data-sharing, or written by a data-sharing DataWriter)
+     * are copied.
+     *
+     * @param reader DataReader from which @c payload was loaned.
+     * @param payload Serialized sample, including its encapsulation.
+     * @param handle InstanceHandle_t of the instance the sample belongs to.
+     * @return RETCODE_OK if the sample is correctly written, any of the standard return codes otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t forward(
+            DataReader* reader,
+            const fastrtps::rtps::SerializedPayload_t& payload,
+            const InstanceHandle_t& handle = HANDLE_NIL);
+
     /*!
      * @brief Informs that the application will be modifying a particular instance.
      * It gives an opportunity to the middleware to pre-configure itself to improve performance.
@@ -87,6 +87,7 @@ class DataReader : public DomainEntity
 protected:
 
     friend class DataReaderImpl;
+    friend class DataWriter;
     friend class SubscriberImpl;
 
     /**
@@ -711,6 +712,61 @@ public:
             void* data,
             SampleInfo* info);
 
+    /**
+     * Access a collection of samples from the DataReader in their serialized form.
+     *
+     * This operation behaves as @ref read, but the elements of @c data_values are
+     * eprosima::fastrtps::rtps::SerializedPayload_t objects holding the serialized samples, which the application can
+     * deserialize lazily, or only partially.
+     *
+     * When @c data_values has no ownership, the returned payloads reference the buffers where the samples were
+     * received, without copying them. Those buffers are kept alive until the loan is returned by means of
+     * @ref return_loan, and must not be modified by the application.
+     * When @c data_values has ownership, the serialized samples are copied into its elements.
+     *
+     * @param [in,out] data_values     A LoanableCollection of SerializedPayload_t where the serialized samples
+     *                                 will be returned.
+     * @param [in,out] sample_infos    A SampleInfoSeq object where the received sample info will be returned.
+     * @param [in]     max_samples     The maximum number of samples to be returned.
+     * @param [in]     sample_states   Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in]     view_states     Only data samples with @c view_state matching one of these will be returned.
+     * @param [in]     instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t read_serialized(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    /**
+     * Access a collection of samples from the DataReader in their serialized form, removing them from the
+     * DataReader.
+     *
+     * This operation behaves as @ref read_serialized, except that the returned samples are 'removed' from the
+     * DataReader as in @ref take.
+     *
+     * @param [in,out] data_values     A LoanableCollection of SerializedPayload_t where the serialized samples
+     *                                 will be returned.
+     * @param [in,out] sample_infos    A SampleInfoSeq object where the received sample info will be returned.
+     * @param [in]     max_samples     The maximum number of samples to be returned.
+     * @param [in]     sample_states   Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in]     view_states     Only data samples with @c view_state matching one of these will be returned.
+     * @param [in]     instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t take_serialized(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
     ///@}
 
     /**
@@ -102,6 +102,20 @@ public:
      */
     RTPS_DllAPI ReturnCode_t enable() override;
 
+    /**
+     * @brief This operation enables all the DataReaders of this Subscriber that are not enabled yet.
+     *
+     * The DataReaders are enabled concurrently by several threads, which makes creating a large number of them
+     * faster than enabling them one by one. The intended use is creating them with the
+     * EntityFactoryQosPolicy::autoenable_created_entities of this Subscriber set to false, and enabling all of them
+     * with a single call to this operation.
+     * None of the affected DataReaders should be deleted while this operation is in progress.
+     *
+     * @return RETCODE_OK if all of them were successfully enabled. RETCODE_PRECONDITION_NOT_MET if this Subscriber
+     *         is not enabled. Otherwise, the error returned by the first DataReader that failed to be enabled.
+     */
+    RTPS_DllAPI ReturnCode_t enable_datareaders();
+
     /**
      * Allows accessing the Subscriber Qos.
      *
@@ -314,6 +314,17 @@ public:
         return false;
     }
 
+    /**
+     * Checks if serialize() returns false when the sample does not fit on the payload, instead of writing beyond
+     * its max_size.
+     * DataWriters only serialize samples of unbounded types on payloads that may be too small when this returns
+     * true. Otherwise, they always get the serialized size of the sample first.
+     */
+    RTPS_DllAPI virtual inline bool serialize_checks_bounds() const
+    {
+        return false;
+    }
+
     /**
      * Construct a sample on a memory location.
      *
@@ -0,0 +1,84 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadSettings.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
+#define _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Settings applied by an internal thread to itself when it starts running.
+ *
+ * The default values leave the thread with the settings inherited from the process.
+ */
+struct ThreadSettings
+{
+    /**
+     * Scheduling policy of the thread.
+     *
+     * On POSIX systems, one of the SCHED_XXX values (SCHED_OTHER, SCHED_FIFO, SCHED_RR, ...).
+     * Ignored on Windows.
+     * A value of -1 keeps the inherited policy.
+     */
+    int32_t scheduling_policy = -1;
+
+    /**
+     * Priority of the thread.
+     *
+     * On POSIX systems, it is the sched_priority for real-time policies (SCHED_FIFO, SCHED_RR) and the nice value
+     * otherwise.
+     * On Windows, it is passed to SetThreadPriority.
+     * A value of std::numeric_limits<int32_t>::min() keeps the inherited priority.
+     */
+    int32_t priority = std::numeric_limits<int32_t>::min();
+
+    /**
+     * Bit mask of the cores the thread is allowed to run on.
+     *
+     * Bit N represents core N.
+     * Ignored on macOS.
+     * A value of 0 keeps the inherited affinity.
+     */
+    uint64_t affinity = 0;
+
+    bool operator ==(
+            const ThreadSettings& b) const
+    {
+        return (this->scheduling_policy == b.scheduling_policy) &&
+               (this->priority == b.priority) &&
+               (this->affinity == b.affinity);
+    }
+
+    bool operator !=(
+            const ThreadSettings& b) const
+    {
+        return !(*this == b);
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
@@ -29,12 +29,14 @@
 #include <fastdds/rtps/builtin/data/BuiltinEndpoints.hpp>
 #include <fastdds/rtps/common/Token.h>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
 
 #if HAVE_SECURITY
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #endif // if HAVE_SECURITY
 
 #include <chrono>
+#include <vector>
 
 #define BUILTIN_PARTICIPANT_DATA_MAX_SIZE 100
 #define TYPELOOKUP_DATA_MAX_SIZE 5000
@@ -213,6 +215,22 @@ public:
         return lease_duration_;
     }
 
+    /**
+     * Check whether a serialized DATA(p) is byte-identical to the one this proxy was last updated from.
+     * @param payload Serialized DATA(p) received from the remote participant.
+     * @return true when the payload has exactly the same contents as the last stored one.
+     */
+    bool is_last_announcement(
+            const SerializedPayload_t& payload) const;
+
+    /**
+     * Store the serialized DATA(p) this proxy has been updated from, so identical periodic announcements
+     * can be detected without deserializing them.
+     * @param payload Serialized DATA(p) received from the remote participant.
+     */
+    void set_last_announcement(
+            const SerializedPayload_t& payload);
+
 private:
 
     //! Store the last timestamp it was received a RTPS message from the remote participant.
@@ -220,6 +238,9 @@ private:
 
     //! Remote participant lease duration in microseconds.
     std::chrono::microseconds lease_duration_;
+
+    //! Serialized DATA(p) this proxy was last updated from.
+    std::vector<octet> last_announcement_;
 };
 
 } /* namespace rtps */
@@ -257,4 +257,25 @@ inline std::istream& operator >>(
 } // namespace fastrtps
 } // namespace eprosima
 
+namespace std {
+template <>
+struct hash<eprosima::fastrtps::rtps::GUID_t>
+{
+    std::size_t operator ()(
+            const eprosima::fastrtps::rtps::GUID_t& k) const
+    {
+        // FNV-1a, continued from the hash of the prefix over the bytes of the entity id
+        uint64_t value = hash<eprosima::fastrtps::rtps::GuidPrefix_t>()(k.guidPrefix);
+        for (size_t i = 0; i < eprosima::fastrtps::rtps::EntityId_t::size; ++i)
+        {
+            value ^= k.entityId.value[i];
+            value *= 1099511628211ull;
+        }
+        return static_cast<std::size_t>(value);
+    }
+
+};
+
+} // namespace std
+
 #endif /* _FASTDDS_RTPS_RTPS_GUID_H_ */
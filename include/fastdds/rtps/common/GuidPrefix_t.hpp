@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <sstream>
 #include <iomanip>
 
@@ -174,4 +175,25 @@ inline std::istream& operator >>(
 } // namespace fastrtps
 } // namespace eprosima
 
+namespace std {
+template <>
+struct hash<eprosima::fastrtps::rtps::GuidPrefix_t>
+{
+    std::size_t operator ()(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& k) const
+    {
+        // FNV-1a over every byte, as the bytes that change between participants depend on the vendor
+        uint64_t value = 14695981039346656037ull;
+        for (size_t i = 0; i < eprosima::fastrtps::rtps::GuidPrefix_t::size; ++i)
+        {
+            value ^= k.value[i];
+            value *= 1099511628211ull;
+        }
+        return static_cast<std::size_t>(value);
+    }
+
+};
+
+} // namespace std
+
 #endif /* _FASTDDS_RTPS_COMMON_GUIDPREFIX_T_HPP_ */
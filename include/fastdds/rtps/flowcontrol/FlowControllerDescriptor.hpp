@@ -18,6 +18,8 @@
 #include "FlowControllerConsts.hpp"
 #include "FlowControllerSchedulerPolicy.hpp"
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -50,6 +52,9 @@ struct FlowControllerDescriptor
     //! Period of time on which the flow controller is allowed to send max_bytes_per_period.
     //! Default value: 100ms.
     uint64_t period_ms = 100;
+
+    //! Thread settings for the sender thread
+    ThreadSettings sender_thread;
 };
 
 } // namespace rtps
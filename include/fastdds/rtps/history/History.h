@@ -29,6 +29,7 @@
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
 #include <fastrtps/utils/TimedMutex.hpp>
+#include <fastrtps/utils/collections/RingBuffer.hpp>
 
 #include <cassert>
 #include <functional>
@@ -57,9 +58,15 @@ protected:
 
 public:
 
-    using iterator = std::vector<CacheChange_t*>::iterator;
-    using reverse_iterator = std::vector<CacheChange_t*>::reverse_iterator;
-    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
+    /**
+     * Container of the changes.
+     * It was a std::vector up to version 2.10.1, so code relying on iterators being std::vector iterators must be
+     * adapted (API and ABI break).
+     */
+    using changes_collection = RingBuffer<CacheChange_t*>;
+    using iterator = changes_collection::iterator;
+    using reverse_iterator = changes_collection::reverse_iterator;
+    using const_iterator = changes_collection::const_iterator;
 
     //!Attributes of the History
     HistoryAttributes m_att;
@@ -131,7 +138,7 @@ public:
      * @param ch Pointer to the CacheChange_t to search for.
      * @return an iterator if a suitable change is found
      */
-    RTPS_DllAPI const_iterator find_change_nts(
+    RTPS_DllAPI virtual const_iterator find_change_nts(
             CacheChange_t* ch);
 
     /**
@@ -280,8 +287,8 @@ public:
 
 protected:
 
-    //!Vector of pointers to the CacheChange_t.
-    std::vector<CacheChange_t*> m_changes;
+    //!Ring buffer of pointers to the CacheChange_t. Removing from the front is O(1).
+    changes_collection m_changes;
 
     //!Variable to know if the history is full without needing to block the History mutex.
     bool m_isHistoryFull = false;
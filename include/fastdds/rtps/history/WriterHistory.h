@@ -93,6 +93,17 @@ public:
             const CacheChange_t* inner,
             CacheChange_t* outer) override;
 
+    /**
+     * Find a specific change in the history.
+     * As changes are kept ordered by sequence number, the position of the change is computed directly when sequence
+     * numbers are consecutive, falling back to a binary search otherwise.
+     * No Thread Safe
+     * @param ch Pointer to the CacheChange_t to search for.
+     * @return an iterator if a suitable change is found
+     */
+    RTPS_DllAPI const_iterator find_change_nts(
+            CacheChange_t* ch) override;
+
     //! Introduce base class method into scope
     using History::remove_change;
 
@@ -281,6 +281,20 @@ private:
             const GuidPrefix_t& destination_guid_prefix,
             bool is_big_submessage);
 
+    /**
+     * Serializes the submessage staged in submessage_msg_ followed by the one written by a functor directly into
+     * the outgoing message, flushing and retrying once if it does not fit.
+     * Used for DATA and DATA_FRAG, so their payload is copied only once into the message to be sent.
+     * @param serialize_submessage Functor with signature bool(CDRMessage_t*) that serializes the submessage.
+     * @param is_big_submessage Reference to the flag updated by the functor telling if the submessage is bigger
+     * than 64KB.
+     * @return true if the submessage was added to the message.
+     */
+    template<typename SerializeFunctor>
+    bool insert_submessage_in_place(
+            const SerializeFunctor& serialize_submessage,
+            const bool& is_big_submessage);
+
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
             const GuidPrefix_t& destination_guid_prefix);
@@ -335,6 +335,18 @@ private:
             const GUID_t& entityGUID,
             WriterProxy** wp) const;
 
+    /*!
+     * Remove from history the not fully assembled change of a writer which has been declared irrelevant.
+     * @param writer Proxy of the writer the change belongs to.
+     * @param seq_num Sequence number of the irrelevant change.
+     * @param history_iterator Hint for the history search. Updated to the position following the removed change.
+     * @remarks Non thread-safe.
+     */
+    void remove_fragmented_change_on_gap(
+            WriterProxy* writer,
+            const SequenceNumber_t& seq_num,
+            History::const_iterator& history_iterator);
+
     /*!
      * @remarks Non thread-safe.
      */
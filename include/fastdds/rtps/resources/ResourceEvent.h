@@ -22,11 +22,13 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 
 #include <thread>
 #include <atomic>
+#include <memory>
 #include <vector>
 
 namespace eprosima {
@@ -49,8 +51,25 @@ public:
 
     /*!
      * @brief Method to initialize the internal thread.
+     *
+     * @param settings Settings applied to the internal thread.
+     * @param name Name given to the internal thread.
+     */
+    void init_thread(
+            const fastdds::rtps::ThreadSettings& settings = {},
+            const char* name = "dds.ev");
+
+    /*!
+     * @brief Method to process the timers of this object on the thread of another ResourceEvent, which may be shared
+     * with other objects, instead of starting an internal thread.
+     *
+     * Calling stop_thread() afterwards unregisters the timers of this object from @c service, so none of them is
+     * triggered again, while the thread of @c service keeps running.
+     *
+     * @param service ResourceEvent whose thread will process the timers of this object.
      */
-    void init_thread();
+    void init_shared(
+            std::shared_ptr<ResourceEvent> service);
 
     void stop_thread();
 
@@ -131,6 +150,12 @@ private:
     //! Execution thread.
     std::thread thread_;
 
+    //! ResourceEvent processing the timers of this object, when initialized with init_shared().
+    std::shared_ptr<ResourceEvent> shared_service_;
+
+    //! Timers of this object currently registered on shared_service_.
+    std::vector<TimedEventImpl*> shared_timers_;
+
     /*!
      * @brief Registers a new TimedEventImpl object in the internal queue to be processed.
      * Non thread safe.
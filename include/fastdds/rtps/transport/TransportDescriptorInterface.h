@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_TRANSPORT_DESCRIPTOR_INTERFACE_H_
 #define _FASTDDS_TRANSPORT_DESCRIPTOR_INTERFACE_H_
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastrtps/fastrtps_dll.h>
 
 #ifdef _WIN32
@@ -39,6 +40,8 @@ class TransportInterface;
  *
  * - maxInitialPeersRange: number of channels opened with each initial remote peer.
  *
+ * - default_reception_threads: settings applied to the threads listening on the transport input channels.
+ *
  * @ingroup RTPS_MODULE
  * */
 struct RTPS_DllAPI TransportDescriptorInterface
@@ -92,7 +95,8 @@ struct RTPS_DllAPI TransportDescriptorInterface
             const TransportDescriptorInterface& t) const
     {
         return (this->maxMessageSize == t.max_message_size() &&
-               this->maxInitialPeersRange == t.max_initial_peers_range());
+               this->maxInitialPeersRange == t.max_initial_peers_range() &&
+               this->default_reception_threads == t.default_reception_threads);
     }
 
     //! Maximum size of a single message in the transport
@@ -100,6 +104,9 @@ struct RTPS_DllAPI TransportDescriptorInterface
 
     //! Number of channels opened with each initial remote peer.
     uint32_t maxInitialPeersRange;
+
+    //! Thread settings for the reception threads of the transport.
+    ThreadSettings default_reception_threads;
 };
 
 } // namespace rtps
@@ -35,6 +35,10 @@ class TransportInterface;
  *
  * - rtps_dump_file_: full path of the protocol dump file.
  *
+ * - wait_spin_time_us_: time a listener busy-waits for new messages before yielding (us).
+ *
+ * - wait_yield_time_us_: time a listener yields the CPU waiting for new messages before blocking (us).
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct SharedMemTransportDescriptor : public TransportDescriptorInterface
@@ -126,6 +130,40 @@ struct SharedMemTransportDescriptor : public TransportDescriptorInterface
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    //! Return the time a listener busy-waits for new messages before yielding (us)
+    RTPS_DllAPI uint32_t wait_spin_time_us() const
+    {
+        return wait_spin_time_us_;
+    }
+
+    /**
+     * Set the time a listener busy-waits for new messages before yielding (us).
+     * While a listener is spinning, writers do not need to wake it up.
+     * The default value of 0 disables this phase.
+     */
+    RTPS_DllAPI void wait_spin_time_us(
+            uint32_t wait_spin_time_us)
+    {
+        wait_spin_time_us_ = wait_spin_time_us;
+    }
+
+    //! Return the time a listener yields the CPU waiting for new messages before blocking (us)
+    RTPS_DllAPI uint32_t wait_yield_time_us() const
+    {
+        return wait_yield_time_us_;
+    }
+
+    /**
+     * Set the time a listener yields the CPU waiting for new messages before blocking (us).
+     * This phase starts when the spinning one finishes.
+     * The default value of 0 disables this phase.
+     */
+    RTPS_DllAPI void wait_yield_time_us(
+            uint32_t wait_yield_time_us)
+    {
+        wait_yield_time_us_ = wait_yield_time_us;
+    }
+
     //! Comparison operator
     RTPS_DllAPI bool operator ==(
             const SharedMemTransportDescriptor& t) const;
@@ -136,6 +174,8 @@ private:
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    uint32_t wait_spin_time_us_;
+    uint32_t wait_yield_time_us_;
 
 };
 
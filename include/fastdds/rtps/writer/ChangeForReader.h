@@ -115,6 +115,7 @@ public:
         {
             unsent_fragments_.base(1u);
             unsent_fragments_.add_range(1u, change_->getFragmentCount() + 1u);
+            underway_fragments_.base(1u);
         }
     }
 
@@ -123,6 +124,17 @@ public:
     {
         unsent_fragments_.remove(sentFragment);
 
+        // Fragments resent after the first stage are kept as underway until the nack supression period expires, so
+        // NACK_FRAG messages crossing the retransmission on the wire do not trigger a second resend.
+        if (delivered_)
+        {
+            if (underway_fragments_.empty())
+            {
+                underway_fragments_.base(sentFragment);
+            }
+            underway_fragments_.add(sentFragment);
+        }
+
         // We only use the running window mechanism during the first stage, until all fragments have been delivered
         // once, and we consider the whole change as delivered.
         if (!delivered_ && !unsent_fragments_.empty() && (unsent_fragments_.max() < change_->getFragmentCount()))
@@ -140,34 +152,68 @@ public:
         }
     }
 
-    void markFragmentsAsUnsent(
+    /**
+     * Mark as unsent the fragments requested on a NACK_FRAG message.
+     * Fragments which are still underway are not requested again.
+     * @param unsentFragments Set of fragments requested by the reader.
+     * @return true if at least one fragment has been marked as unsent.
+     */
+    bool markFragmentsAsUnsent(
             const FragmentNumberSet_t& unsentFragments)
     {
         // Ignore NACK_FRAG messages during the first stage, until all fragments have been delivered once, and we
         // consider the whole change as delivered.
-        if (delivered_)
+        if (!delivered_)
+        {
+            return false;
+        }
+
+        FragmentNumberSet_t requested = unsentFragments;
+        if (!underway_fragments_.empty())
         {
-            if (unsent_fragments_.empty())
+            underway_fragments_.for_each(
+                [&requested](
+                    FragmentNumber_t element)
+                {
+                    requested.remove(element);
+                });
+
+            if (requested.empty())
             {
-                // Current window is empty, so we can set it to the received one.
-                unsent_fragments_ = unsentFragments;
+                return false;
             }
-            else
+        }
+
+        if (unsent_fragments_.empty())
+        {
+            // Current window is empty, so we can set it to the received one.
+            unsent_fragments_ = requested;
+        }
+        else
+        {
+            // Update window to send the lowest possible requested fragments first.
+            FragmentNumber_t other_base = requested.base();
+            if (other_base < unsent_fragments_.base())
             {
-                // Update window to send the lowest possible requested fragments first.
-                FragmentNumber_t other_base = unsentFragments.base();
-                if (other_base < unsent_fragments_.base())
-                {
-                    unsent_fragments_.base_update(other_base);
-                }
-                unsentFragments.for_each(
-                    [this](
-                        FragmentNumber_t element)
-                    {
-                        unsent_fragments_.add(element);
-                    });
+                unsent_fragments_.base_update(other_base);
             }
+            requested.for_each(
+                [this](
+                    FragmentNumber_t element)
+                {
+                    unsent_fragments_.add(element);
+                });
         }
+
+        return !requested.empty();
+    }
+
+    /**
+     * Forget the fragments resent since the last nack supression period, allowing them to be requested again.
+     */
+    void clearUnderwayFragments()
+    {
+        underway_fragments_.base(1u);
     }
 
     bool has_been_delivered() const
@@ -192,6 +238,9 @@ private:
 
     FragmentNumberSet_t unsent_fragments_;
 
+    //! Fragments resent during the current nack supression period.
+    FragmentNumberSet_t underway_fragments_;
+
     //! Indicates if was delivered at least once.
     bool delivered_ = false;
 };
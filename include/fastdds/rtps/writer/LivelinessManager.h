@@ -23,7 +23,10 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <fastrtps/utils/shared_mutex.hpp>
 
+#include <chrono>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -129,6 +132,41 @@ public:
 
 private:
 
+    //! An entry of the expiration heap
+    struct Deadline
+    {
+        //! The time when the writer will lose liveliness
+        std::chrono::steady_clock::time_point time;
+
+        //! The position of the writer on writers_
+        size_t index;
+
+        //! Comparison used to keep the earliest deadline on the top of the heap
+        bool operator >(
+                const Deadline& other) const
+        {
+            return time > other.time;
+        }
+
+    };
+
+    /**
+     * @brief Looks for a writer on the index
+     * @pre The collection shared_mutex must be taken
+     * @return The position of the writer on writers_, or writers_.size() if not found
+     */
+    size_t find_writer(
+            const GUID_t& guid,
+            LivelinessQosPolicyKind kind,
+            const Duration_t& lease_duration) const;
+
+    /**
+     * @brief Adds the current deadline of a writer to the expiration heap
+     * @pre mutex_ must be taken
+     */
+    void push_deadline(
+            size_t index);
+
     /**
      * @brief A method responsible for invoking the callback when liveliness is asserted
      * @param writer The liveliness data of the writer asserting liveliness
@@ -145,6 +183,13 @@ private:
      */
     bool calculate_next();
 
+    /**
+     * @brief Non thread-safe version of calculate_next
+     * @pre The collection shared_mutex and mutex_ must be taken
+     * @return True if at least one writer is alive
+     */
+    bool calculate_next_nts();
+
     //! @brief A method called if the timer expires
     //! @return True if the timer should be restarted
     bool timer_expired();
@@ -158,6 +203,13 @@ private:
     //! A vector of liveliness data
     ResourceLimitedVector<LivelinessData> writers_;
 
+    //! Position of each writer on writers_, indexed by GUID. Protected by col_mutex_.
+    std::unordered_multimap<GUID_t, size_t> writers_index_;
+
+    //! Min-heap with the deadlines of the alive writers. Protected by mutex_.
+    //! Entries that no longer match the deadline of the writer they point to are discarded lazily.
+    std::vector<Deadline> deadlines_;
+
     //! A mutex to protect the liveliness data included LivelinessData objects
     std::mutex mutex_;
 
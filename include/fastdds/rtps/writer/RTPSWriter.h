@@ -23,6 +23,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #include <fastdds/rtps/Endpoint.h>
@@ -485,6 +486,39 @@ public:
 
     virtual LocatorSelectorSender& get_async_locator_selector() = 0;
 
+    /**
+     * Start grouping the submessages of the samples delivered synchronously by the calling thread, so that they are
+     * sent together when @ref end_sample_batch_nts is called instead of on a message per sample.
+     * The batch belongs to the calling thread: samples written by other threads while the writer mutex is released
+     * are not added to it, and other threads cannot open a batch until it ends.
+     * It has no effect on asynchronous writers, whose samples are already grouped by the FlowController.
+     *
+     * @param max_blocking_time Future timepoint where blocking send should end.
+     * @return true when a batch has been opened, which must be ended with @ref end_sample_batch_nts by the same
+     * thread. false when the writer is asynchronous or another batch is open.
+     * @note Must be non-thread safe.
+     */
+    bool begin_sample_batch_nts(
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Send the submessages grouped since @ref begin_sample_batch_nts was called, and stop grouping them.
+     * Should only be called by the thread that opened the batch.
+     *
+     * @note Must be non-thread safe.
+     */
+    void end_sample_batch_nts();
+
+    /**
+     * @return The RTPSMessageGroup where the samples delivered synchronously should be added, or nullptr if the
+     * calling thread has no open batch on this writer.
+     * @note Must be non-thread safe.
+     */
+    RTPSMessageGroup* sample_batch_group_nts() const
+    {
+        return std::this_thread::get_id() == sample_batch_owner_ ? sample_batch_group_ : nullptr;
+    }
+
     /**
      * Send a message through this interface.
      *
@@ -603,6 +637,12 @@ protected:
 
     void deinit();
 
+    /**
+     * Send the submessages grouped by the current sample batch, if any, without ending it.
+     * Should be called before waiting on resources that depend on the grouped samples being sent.
+     */
+    void flush_sample_batch_nts();
+
 private:
 
     RecursiveTimedMutex& get_mutex()
@@ -620,6 +660,12 @@ private:
 
 
     RTPSWriter* next_[2] = { nullptr, nullptr };
+
+    //! Message group where the samples of the current batch are added
+    RTPSMessageGroup* sample_batch_group_ = nullptr;
+
+    //! Thread that opened the current batch
+    std::thread::id sample_batch_owner_;
 };
 
 } /* namespace rtps */
@@ -35,8 +35,10 @@
 #include <fastdds/rtps/writer/ReaderLocator.h>
 
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
+#include <fastrtps/utils/collections/RingBuffer.hpp>
 
 #include <algorithm>
+#include <array>
 #include <mutex>
 #include <set>
 #include <atomic>
@@ -173,7 +175,7 @@ public:
      * @return true if a heartbeat should be sent, false otherwise.
      */
     bool process_initial_acknack(
-            const std::function<void(ChangeForReader_t& change)>& func);
+            const std::function<void(CacheChange_t* change)>& func);
 
     /*!
      * @brief Sets a change to a particular status (if present in the ReaderProxy)
@@ -202,6 +204,7 @@ public:
 
     /**
      * Turns all UNDERWAY changes into UNACKNOWLEDGED.
+     * Fragments resent for those changes can be requested again afterwards.
      *
      * @return true if at least one change changed its status, false otherwise.
      */
@@ -214,7 +217,7 @@ public:
      * @return the number of changes that changed its status.
      */
     uint32_t perform_acknack_response(
-            const std::function<void(ChangeForReader_t& change)>& func);
+            const std::function<void(CacheChange_t* change)>& func);
 
     /**
      * Call this to inform a change was removed from history.
@@ -435,8 +438,18 @@ private:
     bool disable_positive_acks_;
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
-    //!Set of the changes and its state.
-    ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    /**
+     * State of the changes with a sequence number in
+     * [changes_window_base_, changes_window_base_ + changes_window_.size()), one byte per sequence number.
+     * The CacheChange_t of each entry is the one kept on the writer's history.
+     */
+    RingBuffer<uint8_t> changes_window_;
+    //!Sequence number of the first entry of changes_window_.
+    SequenceNumber_t changes_window_base_;
+    //!Number of relevant changes on the window with each ChangeForReaderStatus_t.
+    std::array<uint32_t, UNDERWAY + 1> changes_per_status_;
+    //!Fragmentation state of the fragmented changes on the window, ordered by sequence number.
+    ResourceLimitedVector<ChangeForReader_t, std::true_type> fragmented_changes_;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     TimedEvent* nack_supression_event_;
     TimedEvent* initial_heartbeat_event_;
@@ -451,9 +464,6 @@ private:
 
     bool active_ = false;
 
-    using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
-    using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
-
     void disable_timers();
 
     /*
@@ -466,7 +476,7 @@ private:
     uint32_t convert_status_on_all_changes(
             ChangeForReaderStatus_t previous,
             ChangeForReaderStatus_t next,
-            const std::function<void(ChangeForReader_t& change)>& func = {});
+            const std::function<void(const SequenceNumber_t& seq_num, uint8_t state)>& func = {});
 
     /*!
      * @brief Adds requested fragments. These fragments will be sent in next NackResponseDelay.
@@ -483,23 +493,63 @@ private:
             bool is_relevant);
 
     /**
-     * @brief Find a change with the specified sequence number.
+     * @brief Find the state of a relevant change with the specified sequence number.
      * @param seq_num Sequence number to find.
-     * @param exact When false, the first change with a sequence number not less than seq_num will be returned.
-     * When true, the change with a sequence number value of seq_num will be returned.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
+     * @return Pointer to the state of the change, nullptr if not found.
      */
-    ChangeIterator find_change(
-            const SequenceNumber_t& seq_num,
-            bool exact);
+    uint8_t* find_change_state(
+            const SequenceNumber_t& seq_num);
+
+    const uint8_t* find_change_state(
+            const SequenceNumber_t& seq_num) const;
+
+    /**
+     * @brief Get the entry of the window for a sequence number, growing the window if needed.
+     * New entries are not relevant.
+     * @param seq_num Sequence number of the entry.
+     * @return Reference to the state of the entry.
+     */
+    uint8_t& window_entry(
+            const SequenceNumber_t& seq_num);
+
+    /**
+     * @brief Change the status of a relevant change, keeping the status counters.
+     * @param state State of the change.
+     * @param status New status of the change.
+     */
+    void set_change_status(
+            uint8_t& state,
+            ChangeForReaderStatus_t status);
+
+    /**
+     * @brief Remove all the entries of the window with a sequence number lower than the one given,
+     * and the non relevant entries at the front of the window.
+     * @param seq_num First sequence number to keep.
+     */
+    void remove_changes_before(
+            const SequenceNumber_t& seq_num);
 
     /**
-     * @brief Find a change with the specified sequence number.
+     * @brief Find the fragmentation state of a change.
      * @param seq_num Sequence number to find.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
+     * @return Pointer to the fragmentation state, nullptr if not found.
      */
-    ChangeConstIterator find_change(
+    ChangeForReader_t* find_fragmented_change(
+            const SequenceNumber_t& seq_num);
+
+    const ChangeForReader_t* find_fragmented_change(
             const SequenceNumber_t& seq_num) const;
+
+    /**
+     * @brief Find a change on the writer's history.
+     * @param seq_num Sequence number to find.
+     * @param[in,out] hint Position from which the search starts. Updated with the position of the change found.
+     * It allows looking up changes in increasing order without going through the history more than once.
+     * @return Pointer to the change, nullptr if not found.
+     */
+    CacheChange_t* find_change_in_history(
+            const SequenceNumber_t& seq_num,
+            size_t& hint) const;
 };
 
 } /* namespace rtps */
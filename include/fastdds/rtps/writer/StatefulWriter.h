@@ -290,6 +290,18 @@ public:
         return mp_RTPSParticipant;
     }
 
+    /**
+     * Get a counter that is increased every time the acknowledgement state of the matched readers may have
+     * changed, i.e. when a reader acknowledges new changes or when a reader is matched, updated or unmatched.
+     * It allows to skip checking the acknowledgement of every change when nothing has happened since last check.
+     * @return Current value of the counter.
+     * @note Must be called with the writer mutex taken.
+     */
+    inline uint64_t acknowledgement_generation() const
+    {
+        return acknowledgement_generation_;
+    }
+
     /**
      * Get the number of matched readers
      * @return Number of the matched readers
@@ -501,6 +513,8 @@ private:
     SequenceNumber_t last_sequence_number_;
     //! Biggest sequence number removed from history
     SequenceNumber_t biggest_removed_sequence_number_;
+    //! Increased every time the acknowledgement state of the matched readers may have changed
+    uint64_t acknowledgement_generation_ = 0;
 
     const uint32_t sendBufferSize_;
 
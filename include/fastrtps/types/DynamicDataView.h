@@ -0,0 +1,226 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_DYNAMIC_DATA_VIEW_H
+#define TYPES_DYNAMIC_DATA_VIEW_H
+
+#include <memory>
+#include <string>
+
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypesBase.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+/**
+ * Read-only access to the members of a sample serialized by DynamicPubSubType, without deserializing it.
+ *
+ * The view is bound to a serialized payload, and every access walks the CDR stream up to the requested member.
+ * Offsets of members with a fixed serialized size are computed once per type, when the view is created, so only
+ * variable size members (strings, sequences, and anything containing them) need to be walked on each access.
+ *
+ * Supported kinds are primitives, enumerations, bitmasks, strings, sequences, arrays, structures and aliases
+ * of them. Members of other kinds (unions, maps, bitsets) can be present, but they cannot be accessed, and neither
+ * can any member serialized after them.
+ *
+ * Members of structures are identified by their MemberId, and elements of sequences and arrays by their index,
+ * as in DynamicData. MEMBER_ID_INVALID refers to the value the view is bound to.
+ *
+ * The payload must outlive the view and all the views obtained from it with get_complex_value.
+ */
+class DynamicDataView
+{
+public:
+
+    /**
+     * Creates a view that is not bound to any type nor payload.
+     * It can be used as output parameter of get_complex_value.
+     */
+    RTPS_DllAPI DynamicDataView();
+
+    /**
+     * Creates a view for samples of the given type.
+     * @param type Type of the samples. It should be the one registered with DynamicPubSubType.
+     */
+    RTPS_DllAPI explicit DynamicDataView(
+            DynamicType_ptr type);
+
+    RTPS_DllAPI ~DynamicDataView();
+
+    RTPS_DllAPI DynamicDataView(
+            const DynamicDataView& other);
+
+    RTPS_DllAPI DynamicDataView& operator =(
+            const DynamicDataView& other);
+
+    /**
+     * Binds the view to a serialized sample.
+     * The view can be bound to several samples of the same type, one after the other, reusing the offsets
+     * computed for the type.
+     * @param payload Serialized sample, including the encapsulation header.
+     * @return RETCODE_OK on success, RETCODE_PRECONDITION_NOT_MET if the view was not created with a type,
+     * RETCODE_BAD_PARAMETER if the payload does not start with a CDR encapsulation.
+     */
+    RTPS_DllAPI ReturnCode_t bind(
+            const rtps::SerializedPayload_t& payload);
+
+    RTPS_DllAPI TypeKind get_kind() const;
+
+    /**
+     * Number of items of the value: members of a structure, length of a sequence or string, total bounds of
+     * an array, 1 for the rest of the kinds.
+     */
+    RTPS_DllAPI uint32_t get_item_count() const;
+
+    RTPS_DllAPI MemberId get_member_id_by_name(
+            const std::string& name) const;
+
+    RTPS_DllAPI ReturnCode_t get_int32_value(
+            int32_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_uint32_value(
+            uint32_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_int16_value(
+            int16_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_uint16_value(
+            uint16_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_int64_value(
+            int64_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_uint64_value(
+            uint64_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_float32_value(
+            float& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_float64_value(
+            double& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_float128_value(
+            long double& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_char8_value(
+            char& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_char16_value(
+            wchar_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_byte_value(
+            rtps::octet& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_bool_value(
+            bool& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_enum_value(
+            uint32_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_bitmask_value(
+            uint64_t& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_string_value(
+            std::string& value,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_wstring_value(
+            std::wstring& value,
+            MemberId id) const;
+
+    /**
+     * Gets a view of a member, usually a structure, sequence or array, bound to the same payload.
+     * @param value View to be bound to the member.
+     * @param id Member to be accessed.
+     * @return RETCODE_OK on success, an error code otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t get_complex_value(
+            DynamicDataView& value,
+            MemberId id) const;
+
+private:
+
+    struct Layout;
+
+    class LayoutCache;
+
+    ReturnCode_t find_primitive(
+            TypeKind kind,
+            MemberId id,
+            uint32_t& offset,
+            uint32_t& size) const;
+
+    ReturnCode_t find_member(
+            MemberId id,
+            const Layout*& layout,
+            uint32_t& offset) const;
+
+    ReturnCode_t find_element(
+            const Layout& element,
+            uint32_t count,
+            uint64_t data_offset,
+            MemberId id,
+            uint32_t& offset) const;
+
+    bool skip_value(
+            const Layout& layout,
+            uint64_t& offset) const;
+
+    bool read_length(
+            uint64_t& offset,
+            uint32_t& length) const;
+
+    void read_bytes(
+            uint32_t offset,
+            void* dst,
+            uint32_t size) const;
+
+    std::shared_ptr<LayoutCache> layouts_;
+
+    const Layout* layout_ = nullptr;
+
+    //! Start of the serialized data, after the encapsulation. CDR alignment is relative to it.
+    const rtps::octet* buffer_ = nullptr;
+
+    uint32_t length_ = 0;
+
+    //! Position of the value this view is bound to.
+    uint32_t offset_ = 0;
+
+    bool swap_bytes_ = false;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_DYNAMIC_DATA_VIEW_H
@@ -65,6 +65,11 @@ public:
             void* data,
             eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
 
+    RTPS_DllAPI inline bool serialize_checks_bounds() const override
+    {
+        return true;
+    }
+
     RTPS_DllAPI void CleanDynamicType();
 
     RTPS_DllAPI DynamicType_ptr GetDynamicType() const;
@@ -19,7 +19,11 @@
 #include <fastrtps/types/DynamicTypeBuilder.h>
 #include <fastrtps/types/DynamicTypeBuilderPtr.h>
 #include <fastrtps/types/DynamicTypePtr.h>
+#include <atomic>
+#include <map>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace eprosima {
 namespace fastrtps {
@@ -36,12 +40,14 @@ protected:
     TypeObjectFactory();
     mutable std::map<const std::string, const TypeIdentifier*> identifiers_; // Basic, builtin and EK_MINIMAL
     std::map<const std::string, const TypeIdentifier*> complete_identifiers_; // Only EK_COMPLETE
-    std::map<const TypeIdentifier*, const TypeObject*> objects_; // EK_MINIMAL
-    std::map<const TypeIdentifier*, const TypeObject*> complete_objects_; // EK_COMPLETE
+    std::unordered_map<std::string, const TypeIdentifier*> hashed_identifiers_; // EK_MINIMAL and EK_COMPLETE by hash
+    std::unordered_map<const TypeIdentifier*, const TypeObject*> objects_; // EK_MINIMAL
+    std::unordered_map<const TypeIdentifier*, const TypeObject*> complete_objects_; // EK_COMPLETE
     mutable std::vector<TypeIdentifier*> identifiers_created_;
-    mutable std::map<const TypeIdentifier*, TypeInformation*> informations_;
+    mutable std::unordered_map<const TypeIdentifier*, TypeInformation*> informations_;
     mutable std::vector<TypeInformation*> informations_created_;
-    std::map<std::string, std::string> aliases_; // Aliases
+    std::unordered_map<std::string, std::string> aliases_; // Aliases
+    mutable std::atomic<bool> builtin_annotations_created_{false};
 
     DynamicType_ptr build_dynamic_type(
             TypeDescriptor& descriptor,
@@ -54,13 +60,27 @@ protected:
     const TypeIdentifier* get_stored_type_identifier(
             const TypeIdentifier* identifier) const;
 
+    const TypeIdentifier* find_stored_type_identifier(
+            const TypeIdentifier* identifier) const;
+
     std::string generate_name_and_store_type_identifier(
             const TypeIdentifier* identifier) const;
 
     void nullify_all_entries(
             const TypeIdentifier* identifier);
 
-    void create_builtin_annotations();
+    /**
+     * @brief Registers the builtin annotation types, if they weren't registered yet.
+     * They are created on demand, the first time one of them is looked up, instead of when the factory is created.
+     */
+    void create_builtin_annotations() const;
+
+    /**
+     * @brief Registers the builtin annotation types if the given name is one of them.
+     * @param type_name Name of the type being looked up.
+     */
+    void create_builtin_annotations_if_needed(
+            const std::string& type_name) const;
 
     void apply_type_annotations(
             DynamicTypeBuilder_ptr& type_builder,
@@ -0,0 +1,564 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RingBuffer.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_RINGBUFFER_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_RINGBUFFER_HPP_
+
+#include <assert.h>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Random access sequence container stored on a circular buffer.
+ *
+ * It offers a subset of the std::vector interface, but adding and removing elements at both ends are O(1)
+ * operations. Inserting or erasing elements in the middle moves the elements after the affected position, like
+ * std::vector does.
+ *
+ * Iterators keep an absolute position inside the sequence, so they remain valid when elements are inserted or
+ * removed at the front, and when elements are removed after them. Growing the capacity invalidates all iterators.
+ *
+ * The capacity is always a power of two.
+ *
+ * @tparam _Ty     Element type. Should be default constructible and move assignable.
+ * @tparam _Alloc  Allocator to use on the underlying storage, defaults to std::allocator<_Ty>.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template <
+    typename _Ty,
+    typename _Alloc = std::allocator<_Ty>>
+class RingBuffer
+{
+    using storage_type = std::vector<_Ty, _Alloc>;
+
+public:
+
+    using value_type = _Ty;
+    using allocator_type = _Alloc;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+
+    /**
+     * Random access iterator over the elements of a RingBuffer.
+     *
+     * @tparam IsConst  Whether the iterator gives read-only access to the elements.
+     */
+    template<bool IsConst>
+    class base_iterator
+    {
+        friend class RingBuffer;
+        friend class base_iterator<!IsConst>;
+
+        using container_type = typename std::conditional<IsConst, const RingBuffer, RingBuffer>::type;
+
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = _Ty;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const _Ty*, _Ty*>::type;
+        using reference = typename std::conditional<IsConst, const _Ty&, _Ty&>::type;
+
+        base_iterator() = default;
+
+        //! Allow conversion from iterator to const_iterator
+        template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        base_iterator(
+                const base_iterator<OtherConst>& other)
+            : container_(other.container_)
+            , pos_(other.pos_)
+        {
+        }
+
+        reference operator *() const
+        {
+            return container_->storage_[container_->physical(pos_)];
+        }
+
+        pointer operator ->() const
+        {
+            return &(operator *());
+        }
+
+        reference operator [](
+                difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        base_iterator& operator ++()
+        {
+            ++pos_;
+            return *this;
+        }
+
+        base_iterator operator ++(
+                int)
+        {
+            base_iterator tmp(*this);
+            ++pos_;
+            return tmp;
+        }
+
+        base_iterator& operator --()
+        {
+            --pos_;
+            return *this;
+        }
+
+        base_iterator operator --(
+                int)
+        {
+            base_iterator tmp(*this);
+            --pos_;
+            return tmp;
+        }
+
+        base_iterator& operator +=(
+                difference_type n)
+        {
+            pos_ += static_cast<size_type>(n);
+            return *this;
+        }
+
+        base_iterator& operator -=(
+                difference_type n)
+        {
+            pos_ -= static_cast<size_type>(n);
+            return *this;
+        }
+
+        base_iterator operator +(
+                difference_type n) const
+        {
+            base_iterator tmp(*this);
+            return tmp += n;
+        }
+
+        friend base_iterator operator +(
+                difference_type n,
+                const base_iterator& it)
+        {
+            return it + n;
+        }
+
+        base_iterator operator -(
+                difference_type n) const
+        {
+            base_iterator tmp(*this);
+            return tmp -= n;
+        }
+
+        template<bool OtherConst>
+        difference_type operator -(
+                const base_iterator<OtherConst>& other) const
+        {
+            return static_cast<difference_type>(pos_ - other.pos_);
+        }
+
+        template<bool OtherConst>
+        bool operator ==(
+                const base_iterator<OtherConst>& other) const
+        {
+            return pos_ == other.pos_;
+        }
+
+        template<bool OtherConst>
+        bool operator !=(
+                const base_iterator<OtherConst>& other) const
+        {
+            return pos_ != other.pos_;
+        }
+
+        template<bool OtherConst>
+        bool operator <(
+                const base_iterator<OtherConst>& other) const
+        {
+            return (*this - other) < 0;
+        }
+
+        template<bool OtherConst>
+        bool operator >(
+                const base_iterator<OtherConst>& other) const
+        {
+            return (*this - other) > 0;
+        }
+
+        template<bool OtherConst>
+        bool operator <=(
+                const base_iterator<OtherConst>& other) const
+        {
+            return (*this - other) <= 0;
+        }
+
+        template<bool OtherConst>
+        bool operator >=(
+                const base_iterator<OtherConst>& other) const
+        {
+            return (*this - other) >= 0;
+        }
+
+    private:
+
+        base_iterator(
+                container_type* container,
+                size_type pos)
+            : container_(container)
+            , pos_(pos)
+        {
+        }
+
+        container_type* container_ = nullptr;
+
+        //! Absolute position of the element (not wrapped to the capacity)
+        size_type pos_ = 0;
+    };
+
+    using iterator = base_iterator<false>;
+    using const_iterator = base_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    RingBuffer(
+            const allocator_type& alloc = allocator_type())
+        : storage_(alloc)
+    {
+    }
+
+    RingBuffer(
+            const RingBuffer& other)
+        : storage_(other.storage_.get_allocator())
+    {
+        reserve(other.size());
+        for (const value_type& item : other)
+        {
+            push_back(item);
+        }
+    }
+
+    RingBuffer(
+            RingBuffer&& other)
+        : storage_(std::move(other.storage_))
+        , mask_(other.mask_)
+        , head_(other.head_)
+        , size_(other.size_)
+    {
+        other.mask_ = 0;
+        other.head_ = 0;
+        other.size_ = 0;
+    }
+
+    RingBuffer& operator =(
+            const RingBuffer& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.size());
+            for (const value_type& item : other)
+            {
+                push_back(item);
+            }
+        }
+        return *this;
+    }
+
+    RingBuffer& operator =(
+            RingBuffer&& other)
+    {
+        if (this != &other)
+        {
+            storage_ = std::move(other.storage_);
+            mask_ = other.mask_;
+            head_ = other.head_;
+            size_ = other.size_;
+            other.storage_.clear();
+            other.mask_ = 0;
+            other.head_ = 0;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    // *INDENT-OFF*
+    iterator begin() noexcept { return iterator(this, head_); }
+    const_iterator begin() const noexcept { return const_iterator(this, head_); }
+    const_iterator cbegin() const noexcept { return const_iterator(this, head_); }
+
+    iterator end() noexcept { return iterator(this, head_ + size_); }
+    const_iterator end() const noexcept { return const_iterator(this, head_ + size_); }
+    const_iterator cend() const noexcept { return const_iterator(this, head_ + size_); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    bool empty() const noexcept { return 0 == size_; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return storage_.size(); }
+
+    reference front() { assert(0 < size_); return storage_[physical(head_)]; }
+    const_reference front() const { assert(0 < size_); return storage_[physical(head_)]; }
+    reference back() { assert(0 < size_); return storage_[physical(head_ + size_ - 1)]; }
+    const_reference back() const { assert(0 < size_); return storage_[physical(head_ + size_ - 1)]; }
+
+    reference operator [](size_type n) { return storage_[physical(head_ + n)]; }
+    const_reference operator [](size_type n) const { return storage_[physical(head_ + n)]; }
+    // *INDENT-ON*
+
+    reference at(
+            size_type n)
+    {
+        if (n >= size_)
+        {
+            throw std::out_of_range("RingBuffer::at");
+        }
+        return operator [](n);
+    }
+
+    const_reference at(
+            size_type n) const
+    {
+        if (n >= size_)
+        {
+            throw std::out_of_range("RingBuffer::at");
+        }
+        return operator [](n);
+    }
+
+    /**
+     * Ensure the capacity is enough to hold a number of elements.
+     * The resulting capacity is rounded up to a power of two.
+     *
+     * @param new_cap  Minimum number of elements the collection should be able to hold without reallocating.
+     */
+    void reserve(
+            size_type new_cap)
+    {
+        if (new_cap > capacity())
+        {
+            size_type cap = capacity() > 0 ? capacity() : 1u;
+            while (cap < new_cap)
+            {
+                cap <<= 1;
+            }
+            reallocate(cap);
+        }
+    }
+
+    void clear() noexcept
+    {
+        for (size_type i = 0; i < size_; ++i)
+        {
+            storage_[physical(head_ + i)] = value_type();
+        }
+        head_ = 0;
+        size_ = 0;
+    }
+
+    void push_back(
+            const value_type& value)
+    {
+        grow_if_full();
+        storage_[physical(head_ + size_)] = value;
+        ++size_;
+    }
+
+    void push_front(
+            const value_type& value)
+    {
+        grow_if_full();
+        --head_;
+        storage_[physical(head_)] = value;
+        ++size_;
+    }
+
+    void pop_back()
+    {
+        assert(0 < size_);
+        --size_;
+        storage_[physical(head_ + size_)] = value_type();
+    }
+
+    void pop_front()
+    {
+        assert(0 < size_);
+        storage_[physical(head_)] = value_type();
+        ++head_;
+        --size_;
+    }
+
+    /**
+     * Insert an element before the given position.
+     * Inserting at any of the ends is O(1). Otherwise, the elements after the position are moved.
+     *
+     * @param pos    Iterator before which the element will be inserted.
+     * @param value  Element to insert.
+     *
+     * @return Iterator pointing to the inserted element.
+     */
+    iterator insert(
+            const_iterator pos,
+            const value_type& value)
+    {
+        size_type index = pos.pos_ - head_;
+        assert(index <= size_);
+
+        if (0 == index)
+        {
+            push_front(value);
+            return begin();
+        }
+
+        grow_if_full();
+        for (size_type i = size_; i > index; --i)
+        {
+            storage_[physical(head_ + i)] = std::move(storage_[physical(head_ + i - 1)]);
+        }
+        storage_[physical(head_ + index)] = value;
+        ++size_;
+        return iterator(this, head_ + index);
+    }
+
+    /**
+     * Remove the element at the given position.
+     * Removing any of the ends is O(1). Otherwise, the elements after the position are moved.
+     *
+     * @param pos  Iterator to the element to remove.
+     *
+     * @return Iterator following the removed element.
+     */
+    iterator erase(
+            const_iterator pos)
+    {
+        size_type index = pos.pos_ - head_;
+        assert(index < size_);
+
+        if (0 == index)
+        {
+            pop_front();
+            return begin();
+        }
+
+        for (size_type i = index + 1; i < size_; ++i)
+        {
+            storage_[physical(head_ + i - 1)] = std::move(storage_[physical(head_ + i)]);
+        }
+        pop_back();
+        return iterator(this, head_ + index);
+    }
+
+    /**
+     * Remove the elements in the range [first, last).
+     *
+     * @param first  Iterator to the first element to remove.
+     * @param last   Iterator following the last element to remove.
+     *
+     * @return Iterator following the last removed element.
+     */
+    iterator erase(
+            const_iterator first,
+            const_iterator last)
+    {
+        size_type index = first.pos_ - head_;
+        size_type count = last.pos_ - first.pos_;
+        assert(index + count <= size_);
+
+        if (0 == index)
+        {
+            for (size_type i = 0; i < count; ++i)
+            {
+                pop_front();
+            }
+            return begin();
+        }
+
+        for (size_type i = index + count; i < size_; ++i)
+        {
+            storage_[physical(head_ + i - count)] = std::move(storage_[physical(head_ + i)]);
+        }
+        for (size_type i = 0; i < count; ++i)
+        {
+            pop_back();
+        }
+        return iterator(this, head_ + index);
+    }
+
+private:
+
+    size_type physical(
+            size_type pos) const noexcept
+    {
+        return pos & mask_;
+    }
+
+    void grow_if_full()
+    {
+        if (size_ == capacity())
+        {
+            reallocate(size_ > 0 ? size_ * 2 : 1u);
+        }
+    }
+
+    void reallocate(
+            size_type new_cap)
+    {
+        storage_type new_storage(new_cap, value_type(), storage_.get_allocator());
+        size_type new_mask = new_cap - 1;
+        for (size_type i = 0; i < size_; ++i)
+        {
+            new_storage[(head_ + i) & new_mask] = std::move(storage_[physical(head_ + i)]);
+        }
+        storage_.swap(new_storage);
+        mask_ = new_mask;
+    }
+
+    //! Underlying storage. Its size is the capacity of the ring.
+    storage_type storage_;
+
+    //! Mask to translate absolute positions into storage indexes.
+    size_type mask_ = 0;
+
+    //! Absolute position of the first element.
+    size_type head_ = 0;
+
+    //! Number of elements.
+    size_type size_ = 0;
+};
+
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_RINGBUFFER_HPP_ */
@@ -480,6 +480,69 @@ public:
         }
     }
 
+    /**
+     * Apply a function on every run of consecutive items on the range.
+     *
+     * @param f   Function to apply on each run. It receives the first item of the run and the number of items on it.
+     */
+    template<class BinaryFunc>
+    void for_each_run(
+            BinaryFunc f) const
+    {
+        uint32_t run_start = 0;
+        uint32_t run_length = 0;
+
+        // Traverse through the significant items on the bitmap
+        uint32_t n_longs = (num_bits_ + 31u) / 32u;
+        for (uint32_t i = 0; i < n_longs; i++)
+        {
+            // Traverse through the runs of bits set on the item, msb first.
+            // Leading zeroes give the distance to the next run, and leading zeroes of the complement its length.
+            uint32_t bits = bitmap_[i];
+            uint32_t pos = 0;
+            while (pos < 32u)
+            {
+                if (0u == bits)
+                {
+                    break;
+                }
+
+                uint32_t zeros = leading_zeros(bits);
+                if (0u < zeros)
+                {
+                    if (0u < run_length)
+                    {
+                        f(base_ + run_start, run_length);
+                        run_length = 0;
+                    }
+                    pos += zeros;
+                    bits <<= zeros;
+                }
+
+                uint32_t ones = (0u == ~bits) ? 32u : leading_zeros(~bits);
+                if (0u == run_length)
+                {
+                    run_start = i * 32u + pos;
+                }
+                run_length += ones;
+                pos += ones;
+                bits = (ones < 32u) ? (bits << ones) : 0u;
+            }
+
+            // A run only continues on the next item if it reaches the last bit of this one
+            if (0u < run_length && pos < 32u)
+            {
+                f(base_ + run_start, run_length);
+                run_length = 0;
+            }
+        }
+
+        if (0u < run_length)
+        {
+            f(base_ + run_start, run_length);
+        }
+    }
+
 protected:
 
     T base_;               ///< Holds base value of the range.
@@ -489,6 +552,19 @@ protected:
 
 private:
 
+    //! Number of leading zero bits of a non-zero value.
+    static uint32_t leading_zeros(
+            uint32_t bits)
+    {
+#if _MSC_VER
+        unsigned long bit;
+        _BitScanReverse(&bit, bits);
+        return 31u ^ static_cast<uint32_t>(bit);
+#else
+        return static_cast<uint32_t>(__builtin_clz(bits));
+#endif // if _MSC_VER
+    }
+
     void shift_map_left(
             uint32_t n_bits)
     {
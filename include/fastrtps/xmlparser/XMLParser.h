@@ -519,6 +519,11 @@ protected:
             rtps::InitialAnnouncementConfig& config,
             uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLThreadSettings(
+            tinyxml2::XMLElement* elem,
+            fastdds::rtps::ThreadSettings& thread_setting,
+            uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLBuiltinAttributes(
             tinyxml2::XMLElement* elem,
             rtps::BuiltinAttributes& builtin,
@@ -77,9 +77,12 @@ extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
 extern const char* SEGMENT_OVERFLOW_POLICY;
 extern const char* HEALTHY_CHECK_TIMEOUT_MS;
+extern const char* WAIT_SPIN_TIME_US;
+extern const char* WAIT_YIELD_TIME_US;
 extern const char* DISCARD;
 extern const char* FAIL;
 extern const char* RTPS_DUMP_FILE;
+extern const char* DEFAULT_RECEPTION_THREADS;
 extern const char* ON;
 
 // IntraprocessDeliveryType
@@ -117,6 +120,11 @@ extern const char* IP6_TO_SEND;
 extern const char* THROUGHPUT_CONT;
 extern const char* USER_TRANS;
 extern const char* USE_BUILTIN_TRANS;
+extern const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS;
+extern const char* TIMED_EVENTS_THREAD;
+extern const char* DISCOVERY_SERVER_THREAD;
+extern const char* BUILTIN_CONTROLLERS_SENDER_THREAD;
+extern const char* DATA_SHARING_LISTENER_THREAD;
 extern const char* PROPERTIES_POLICY;
 extern const char* NAME;
 extern const char* REMOTE_LOCATORS;
@@ -393,6 +401,12 @@ extern const char* BASE_TYPE;
 extern const char* USE_DEFAULT;
 extern const char* CONSUMER;
 extern const char* CLASS;
+extern const char* THREAD_SETTINGS;
+
+// Thread settings
+extern const char* SCHEDULING_POLICY;
+extern const char* PRIORITY;
+extern const char* AFFINITY;
 
 // Allocation config
 extern const char* INITIAL;
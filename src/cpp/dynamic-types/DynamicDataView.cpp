@@ -0,0 +1,1031 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/DynamicDataView.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/types/TypeDescriptor.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+/**
+ * Serialization information of a type, computed once and shared by all the views of the type.
+ * Serialized sizes and offsets depend on the CDR alignment of the position where the value starts, so they are
+ * stored for every possible start position modulo 8 (the largest CDR alignment).
+ */
+struct DynamicDataView::Layout
+{
+    struct Member
+    {
+        MemberId id = MEMBER_ID_INVALID;
+        std::string name;
+        const Layout* layout = nullptr;
+        bool is_serialized = true;
+    };
+
+    TypeKind kind = TK_NONE;
+
+    //! Whether values of this type can be accessed and skipped
+    bool is_supported = false;
+
+    //! Serialized size of primitive kinds
+    uint32_t primitive_size = 0;
+
+    //! CDR alignment of primitive kinds
+    uint32_t primitive_alignment = 1;
+
+    //! Largest CDR alignment of the primitives the value is made of
+    uint32_t alignment = 1;
+
+    //! Whether the serialized size of the value only depends on its start position
+    bool is_fixed_size = false;
+
+    //! Serialized size for each start position modulo 8. Only valid if is_fixed_size.
+    std::array<uint32_t, 8> fixed_size{};
+
+    //! Members of structures, ordered by id
+    std::vector<Member> members;
+
+    //! Number of leading members of a structure whose offset does not depend on the data
+    size_t fixed_members = 0;
+
+    //! Offsets of the leading fixed_members members, and of the first byte after them, relative to the start
+    //! of the structure, for each start position modulo 8
+    std::array<std::vector<uint32_t>, 8> member_offsets;
+
+    //! Element of sequences and arrays
+    const Layout* element = nullptr;
+
+    //! Total bounds of arrays
+    uint32_t bound = 0;
+};
+
+class DynamicDataView::LayoutCache
+{
+public:
+
+    const Layout* get(
+            DynamicType_ptr type)
+    {
+        while (type && TK_ALIAS == type->get_kind())
+        {
+            type = type->get_descriptor()->get_base_type();
+        }
+
+        if (!type)
+        {
+            return nullptr;
+        }
+
+        auto it = layouts_.find(type.get());
+        if (it != layouts_.end())
+        {
+            return it->second.get();
+        }
+
+        Layout* layout = new Layout();
+        layouts_[type.get()].reset(layout);
+        fill(*layout, type);
+        return layout;
+    }
+
+    //! Advances the offset over count elements of fixed size.
+    static void advance_fixed_elements(
+            const Layout& element,
+            uint64_t count,
+            uint64_t& offset)
+    {
+        if (0 == count)
+        {
+            return;
+        }
+
+        offset += element.fixed_size[offset % 8];
+        --count;
+
+        // Once aligned, elements keep the same alignment when their size is a multiple of it
+        uint32_t stride = element.fixed_size[offset % 8];
+        if (0 == stride % element.alignment)
+        {
+            offset += count * stride;
+        }
+        else
+        {
+            for (; count > 0; --count)
+            {
+                offset += element.fixed_size[offset % 8];
+            }
+        }
+    }
+
+    static uint64_t align(
+            uint64_t offset,
+            uint32_t alignment)
+    {
+        return (offset + alignment - 1) & ~static_cast<uint64_t>(alignment - 1);
+    }
+
+private:
+
+    static void set_primitive(
+            Layout& layout,
+            uint32_t size,
+            uint32_t alignment)
+    {
+        layout.is_supported = true;
+        layout.is_fixed_size = true;
+        layout.primitive_size = size;
+        layout.primitive_alignment = alignment;
+        layout.alignment = alignment;
+    }
+
+    void fill(
+            Layout& layout,
+            const DynamicType_ptr& type)
+    {
+        layout.kind = type->get_kind();
+
+        if (type->get_descriptor()->annotation_is_non_serialized())
+        {
+            // Nothing is serialized for this type
+            layout.is_supported = true;
+            layout.is_fixed_size = true;
+            return;
+        }
+
+        switch (layout.kind)
+        {
+            case TK_BOOLEAN:
+            case TK_BYTE:
+            case TK_CHAR8:
+                set_primitive(layout, 1, 1);
+                break;
+            case TK_INT16:
+            case TK_UINT16:
+                set_primitive(layout, 2, 2);
+                break;
+            case TK_CHAR16:
+            // Wide characters are serialized as 32 bits values
+            case TK_INT32:
+            case TK_UINT32:
+            case TK_FLOAT32:
+            case TK_ENUM:
+                set_primitive(layout, 4, 4);
+                break;
+            case TK_INT64:
+            case TK_UINT64:
+            case TK_FLOAT64:
+                set_primitive(layout, 8, 8);
+                break;
+            case TK_FLOAT128:
+                set_primitive(layout, 16, 8);
+                break;
+            case TK_BITMASK:
+                // Same holder types DynamicData uses to serialize bitmasks
+                switch (type->get_size())
+                {
+                    case 1: set_primitive(layout, 1, 1); break;
+                    case 2: set_primitive(layout, 2, 2); break;
+                    case 3: set_primitive(layout, 4, 4); break;
+                    case 4: set_primitive(layout, 8, 8); break;
+                    default: break;
+                }
+                break;
+            case TK_STRING8:
+            case TK_STRING16:
+                layout.is_supported = true;
+                layout.alignment = 4;
+                break;
+            case TK_SEQUENCE:
+                layout.element = get(type->get_descriptor()->get_element_type());
+                layout.is_supported = nullptr != layout.element && layout.element->is_supported;
+                layout.alignment = layout.is_supported ? std::max(4u, layout.element->alignment) : 4u;
+                break;
+            case TK_ARRAY:
+                layout.element = get(type->get_descriptor()->get_element_type());
+                layout.bound = type->get_total_bounds();
+                layout.is_supported = nullptr != layout.element && layout.element->is_supported;
+                layout.is_fixed_size = layout.is_supported && layout.element->is_fixed_size;
+                layout.alignment = layout.is_supported ? layout.element->alignment : 1u;
+                break;
+            case TK_STRUCTURE:
+                fill_structure(layout, type);
+                break;
+            default:
+                break;
+        }
+
+        if (layout.is_fixed_size)
+        {
+            for (uint32_t start = 0; start < 8; ++start)
+            {
+                uint64_t offset = start;
+                advance_fixed(layout, offset);
+                layout.fixed_size[start] = static_cast<uint32_t>(offset - start);
+            }
+        }
+    }
+
+    void fill_structure(
+            Layout& layout,
+            const DynamicType_ptr& type)
+    {
+        std::map<MemberId, DynamicTypeMember*> members;
+        type->get_all_members(members);
+
+        layout.is_supported = true;
+        layout.is_fixed_size = true;
+        bool prefix_is_fixed = true;
+        for (auto& member : members)
+        {
+            const MemberDescriptor* descriptor = member.second->get_descriptor();
+
+            Layout::Member info;
+            info.id = member.first;
+            info.name = descriptor->get_name();
+            info.is_serialized = !descriptor->annotation_is_non_serialized();
+            if (info.is_serialized)
+            {
+                info.layout = get(descriptor->get_type());
+                bool is_fixed = nullptr != info.layout && info.layout->is_fixed_size;
+                layout.is_fixed_size &= is_fixed;
+                prefix_is_fixed &= is_fixed;
+                if (nullptr != info.layout)
+                {
+                    layout.alignment = std::max(layout.alignment, info.layout->alignment);
+                }
+            }
+            if (prefix_is_fixed)
+            {
+                ++layout.fixed_members;
+            }
+            layout.members.push_back(std::move(info));
+        }
+
+        for (uint32_t start = 0; start < 8; ++start)
+        {
+            std::vector<uint32_t>& offsets = layout.member_offsets[start];
+            offsets.reserve(layout.fixed_members + 1);
+            uint64_t offset = start;
+            for (size_t i = 0; i < layout.fixed_members; ++i)
+            {
+                offsets.push_back(static_cast<uint32_t>(offset - start));
+                const Layout::Member& member = layout.members[i];
+                if (member.is_serialized)
+                {
+                    offset += member.layout->fixed_size[offset % 8];
+                }
+            }
+            offsets.push_back(static_cast<uint32_t>(offset - start));
+        }
+    }
+
+    //! Computes the serialized size of a fixed size type, from the already computed sizes of its components.
+    static void advance_fixed(
+            const Layout& layout,
+            uint64_t& offset)
+    {
+        switch (layout.kind)
+        {
+            case TK_ARRAY:
+                advance_fixed_elements(*layout.element, layout.bound, offset);
+                break;
+            case TK_STRUCTURE:
+                offset += layout.member_offsets[offset % 8].back();
+                break;
+            default:
+                if (0 < layout.primitive_size)
+                {
+                    offset = align(offset, layout.primitive_alignment) + layout.primitive_size;
+                }
+                break;
+        }
+    }
+
+    std::map<const DynamicType*, std::unique_ptr<Layout>> layouts_;
+};
+
+DynamicDataView::DynamicDataView() = default;
+
+DynamicDataView::DynamicDataView(
+        DynamicType_ptr type)
+    : layouts_(std::make_shared<LayoutCache>())
+{
+    layout_ = layouts_->get(type);
+}
+
+DynamicDataView::~DynamicDataView() = default;
+
+DynamicDataView::DynamicDataView(
+        const DynamicDataView& other) = default;
+
+DynamicDataView& DynamicDataView::operator =(
+        const DynamicDataView& other) = default;
+
+ReturnCode_t DynamicDataView::bind(
+        const rtps::SerializedPayload_t& payload)
+{
+    if (nullptr == layout_)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    // Only plain CDR is used by DynamicPubSubType
+    if (nullptr == payload.data || payload.length < 4 || 0 != payload.data[0] || payload.data[1] > CDR_LE)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    bool is_little_endian = CDR_LE == payload.data[1];
+#if FASTDDS_IS_BIG_ENDIAN_TARGET
+    swap_bytes_ = is_little_endian;
+#else
+    swap_bytes_ = !is_little_endian;
+#endif // if FASTDDS_IS_BIG_ENDIAN_TARGET
+    buffer_ = payload.data + 4;
+    length_ = payload.length - 4;
+    offset_ = 0;
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+TypeKind DynamicDataView::get_kind() const
+{
+    return nullptr != layout_ ? layout_->kind : TK_NONE;
+}
+
+uint32_t DynamicDataView::get_item_count() const
+{
+    if (nullptr == layout_)
+    {
+        return 0;
+    }
+
+    switch (layout_->kind)
+    {
+        case TK_STRUCTURE:
+            return static_cast<uint32_t>(layout_->members.size());
+        case TK_ARRAY:
+            return layout_->bound;
+        case TK_SEQUENCE:
+        case TK_STRING8:
+        case TK_STRING16:
+        {
+            uint64_t offset = offset_;
+            uint32_t length = 0;
+            if (nullptr == buffer_ || !read_length(offset, length))
+            {
+                return 0;
+            }
+            // Serialized length of narrow strings includes the null terminator
+            if (TK_STRING8 == layout_->kind && 0 < length)
+            {
+                --length;
+            }
+            return length;
+        }
+        default:
+            return 1;
+    }
+}
+
+MemberId DynamicDataView::get_member_id_by_name(
+        const std::string& name) const
+{
+    if (nullptr != layout_)
+    {
+        for (const Layout::Member& member : layout_->members)
+        {
+            if (member.name == name)
+            {
+                return member.id;
+            }
+        }
+    }
+
+    return MEMBER_ID_INVALID;
+}
+
+ReturnCode_t DynamicDataView::get_int32_value(
+        int32_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_INT32, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_uint32_value(
+        uint32_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_UINT32, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_int16_value(
+        int16_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_INT16, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_uint16_value(
+        uint16_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_UINT16, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_int64_value(
+        int64_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_INT64, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_uint64_value(
+        uint64_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_UINT64, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_float32_value(
+        float& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_FLOAT32, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_float64_value(
+        double& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_FLOAT64, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_float128_value(
+        long double& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_FLOAT128, id, offset, size);
+    if (!!ret)
+    {
+        // The 16 bytes on the wire hold the native representation of long double
+        rtps::octet aux[16];
+        read_bytes(offset, aux, size);
+        memcpy(&value, aux, std::min(sizeof(value), sizeof(aux)));
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_char8_value(
+        char& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_CHAR8, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_char16_value(
+        wchar_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_CHAR16, id, offset, size);
+    if (!!ret)
+    {
+        uint32_t aux = 0;
+        read_bytes(offset, &aux, size);
+        value = static_cast<wchar_t>(aux);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_byte_value(
+        rtps::octet& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_BYTE, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_bool_value(
+        bool& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_BOOLEAN, id, offset, size);
+    if (!!ret)
+    {
+        value = 0 != buffer_[offset];
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_enum_value(
+        uint32_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_ENUM, id, offset, size);
+    if (!!ret)
+    {
+        read_bytes(offset, &value, size);
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_bitmask_value(
+        uint64_t& value,
+        MemberId id) const
+{
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    ReturnCode_t ret = find_primitive(TK_BITMASK, id, offset, size);
+    if (!!ret)
+    {
+        switch (size)
+        {
+            case 1:
+            {
+                uint8_t aux = 0;
+                read_bytes(offset, &aux, size);
+                value = aux;
+                break;
+            }
+            case 2:
+            {
+                uint16_t aux = 0;
+                read_bytes(offset, &aux, size);
+                value = aux;
+                break;
+            }
+            case 4:
+            {
+                uint32_t aux = 0;
+                read_bytes(offset, &aux, size);
+                value = aux;
+                break;
+            }
+            default:
+                read_bytes(offset, &value, size);
+                break;
+        }
+    }
+    return ret;
+}
+
+ReturnCode_t DynamicDataView::get_string_value(
+        std::string& value,
+        MemberId id) const
+{
+    const Layout* layout = nullptr;
+    uint32_t offset = 0;
+    ReturnCode_t ret = find_member(id, layout, offset);
+    if (!ret)
+    {
+        return ret;
+    }
+    if (TK_STRING8 != layout->kind)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    uint64_t position = offset;
+    uint32_t length = 0;
+    if (!read_length(position, length) || position + length > length_)
+    {
+        return ReturnCode_t::RETCODE_ERROR;
+    }
+
+    const char* chars = reinterpret_cast<const char*>(buffer_ + position);
+    if (0 < length && '\0' == chars[length - 1])
+    {
+        --length;
+    }
+    value.assign(chars, length);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DynamicDataView::get_wstring_value(
+        std::wstring& value,
+        MemberId id) const
+{
+    const Layout* layout = nullptr;
+    uint32_t offset = 0;
+    ReturnCode_t ret = find_member(id, layout, offset);
+    if (!ret)
+    {
+        return ret;
+    }
+    if (TK_STRING16 != layout->kind)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    // Wide characters are serialized as 32 bits values
+    uint64_t position = offset;
+    uint32_t length = 0;
+    if (!read_length(position, length) || position + uint64_t(length) * 4u > length_)
+    {
+        return ReturnCode_t::RETCODE_ERROR;
+    }
+
+    value.resize(length);
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        uint32_t aux = 0;
+        read_bytes(static_cast<uint32_t>(position + i * 4u), &aux, 4u);
+        value[i] = static_cast<wchar_t>(aux);
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DynamicDataView::get_complex_value(
+        DynamicDataView& value,
+        MemberId id) const
+{
+    const Layout* layout = nullptr;
+    uint32_t offset = 0;
+    ReturnCode_t ret = find_member(id, layout, offset);
+    if (!ret)
+    {
+        return ret;
+    }
+    if (!layout->is_supported)
+    {
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    value.layouts_ = layouts_;
+    value.layout_ = layout;
+    value.buffer_ = buffer_;
+    value.length_ = length_;
+    value.offset_ = offset;
+    value.swap_bytes_ = swap_bytes_;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DynamicDataView::find_primitive(
+        TypeKind kind,
+        MemberId id,
+        uint32_t& offset,
+        uint32_t& size) const
+{
+    const Layout* layout = nullptr;
+    ReturnCode_t ret = find_member(id, layout, offset);
+    if (!ret)
+    {
+        return ret;
+    }
+    if (kind != layout->kind || 0 == layout->primitive_size)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    uint64_t position = LayoutCache::align(offset, layout->primitive_alignment);
+    if (position + layout->primitive_size > length_)
+    {
+        return ReturnCode_t::RETCODE_ERROR;
+    }
+
+    offset = static_cast<uint32_t>(position);
+    size = layout->primitive_size;
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DynamicDataView::find_member(
+        MemberId id,
+        const Layout*& layout,
+        uint32_t& offset) const
+{
+    if (nullptr == layout_ || nullptr == buffer_)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    if (MEMBER_ID_INVALID == id)
+    {
+        layout = layout_;
+        offset = offset_;
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    switch (layout_->kind)
+    {
+        case TK_STRUCTURE:
+        {
+            const std::vector<Layout::Member>& members = layout_->members;
+            auto it = std::lower_bound(members.begin(), members.end(), id,
+                            [](const Layout::Member& member, MemberId member_id)
+                            {
+                                return member.id < member_id;
+                            });
+            if (it == members.end() || it->id != id)
+            {
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+            if (!it->is_serialized)
+            {
+                return ReturnCode_t::RETCODE_NO_DATA;
+            }
+            if (nullptr == it->layout)
+            {
+                return ReturnCode_t::RETCODE_UNSUPPORTED;
+            }
+
+            size_t index = static_cast<size_t>(it - members.begin());
+            const std::vector<uint32_t>& offsets = layout_->member_offsets[offset_ % 8];
+            if (index < layout_->fixed_members)
+            {
+                offset = offset_ + offsets[index];
+            }
+            else
+            {
+                // Walk the members after the ones with known offsets
+                uint64_t position = uint64_t(offset_) + offsets.back();
+                for (size_t i = layout_->fixed_members; i < index; ++i)
+                {
+                    const Layout::Member& member = members[i];
+                    if (!member.is_serialized)
+                    {
+                        continue;
+                    }
+                    if (nullptr == member.layout || !member.layout->is_supported)
+                    {
+                        return ReturnCode_t::RETCODE_UNSUPPORTED;
+                    }
+                    if (!skip_value(*member.layout, position))
+                    {
+                        return ReturnCode_t::RETCODE_ERROR;
+                    }
+                }
+                offset = static_cast<uint32_t>(position);
+            }
+            layout = it->layout;
+            return ReturnCode_t::RETCODE_OK;
+        }
+        case TK_SEQUENCE:
+        {
+            uint64_t position = offset_;
+            uint32_t count = 0;
+            if (!read_length(position, count))
+            {
+                return ReturnCode_t::RETCODE_ERROR;
+            }
+            layout = layout_->element;
+            return find_element(*layout_->element, count, position, id, offset);
+        }
+        case TK_ARRAY:
+            layout = layout_->element;
+            return find_element(*layout_->element, layout_->bound, offset_, id, offset);
+        default:
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+}
+
+ReturnCode_t DynamicDataView::find_element(
+        const Layout& element,
+        uint32_t count,
+        uint64_t data_offset,
+        MemberId id,
+        uint32_t& offset) const
+{
+    if (id >= count)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    if (!element.is_supported)
+    {
+        return ReturnCode_t::RETCODE_UNSUPPORTED;
+    }
+
+    uint64_t position = data_offset;
+    if (element.is_fixed_size)
+    {
+        LayoutCache::advance_fixed_elements(element, id, position);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < id; ++i)
+        {
+            if (!skip_value(element, position))
+            {
+                return ReturnCode_t::RETCODE_ERROR;
+            }
+        }
+    }
+
+    if (position > length_)
+    {
+        return ReturnCode_t::RETCODE_ERROR;
+    }
+    offset = static_cast<uint32_t>(position);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+bool DynamicDataView::skip_value(
+        const Layout& layout,
+        uint64_t& offset) const
+{
+    if (!layout.is_supported)
+    {
+        return false;
+    }
+
+    if (layout.is_fixed_size)
+    {
+        offset += layout.fixed_size[offset % 8];
+        return offset <= length_;
+    }
+
+    switch (layout.kind)
+    {
+        case TK_STRING8:
+        case TK_STRING16:
+        {
+            uint32_t length = 0;
+            if (!read_length(offset, length))
+            {
+                return false;
+            }
+            offset += TK_STRING8 == layout.kind ? uint64_t(length) : uint64_t(length) * 4u;
+            break;
+        }
+        case TK_SEQUENCE:
+        {
+            uint32_t count = 0;
+            if (!read_length(offset, count))
+            {
+                return false;
+            }
+            if (layout.element->is_fixed_size)
+            {
+                LayoutCache::advance_fixed_elements(*layout.element, count, offset);
+            }
+            else
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    if (!skip_value(*layout.element, offset))
+                    {
+                        return false;
+                    }
+                }
+            }
+            break;
+        }
+        case TK_ARRAY:
+            for (uint32_t i = 0; i < layout.bound; ++i)
+            {
+                if (!skip_value(*layout.element, offset))
+                {
+                    return false;
+                }
+            }
+            break;
+        case TK_STRUCTURE:
+            offset += layout.member_offsets[offset % 8].back();
+            for (size_t i = layout.fixed_members; i < layout.members.size(); ++i)
+            {
+                const Layout::Member& member = layout.members[i];
+                if (member.is_serialized && (nullptr == member.layout || !skip_value(*member.layout, offset)))
+                {
+                    return false;
+                }
+            }
+            break;
+        default:
+            return false;
+    }
+
+    return offset <= length_;
+}
+
+bool DynamicDataView::read_length(
+        uint64_t& offset,
+        uint32_t& length) const
+{
+    uint64_t position = LayoutCache::align(offset, 4);
+    if (position + 4 > length_)
+    {
+        return false;
+    }
+
+    read_bytes(static_cast<uint32_t>(position), &length, 4);
+    offset = position + 4;
+    return true;
+}
+
+void DynamicDataView::read_bytes(
+        uint32_t offset,
+        void* dst,
+        uint32_t size) const
+{
+    rtps::octet* out = static_cast<rtps::octet*>(dst);
+    if (swap_bytes_)
+    {
+        std::reverse_copy(buffer_ + offset, buffer_ + offset + size, out);
+    }
+    else
+    {
+        memcpy(out, buffer_ + offset, size);
+    }
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
@@ -25,7 +25,9 @@
 #include <fastrtps/types/AnnotationDescriptor.h>
 #include <fastrtps/utils/md5.h>
 #include <fastdds/dds/log/Log.hpp>
+#include <cstring>
 #include <sstream>
+#include <unordered_set>
 
 namespace eprosima {
 namespace fastrtps {
@@ -49,11 +51,42 @@ TypeObjectFactory* TypeObjectFactory::get_instance()
     if (g_instance == nullptr)
     {
         g_instance = new TypeObjectFactory();
-        g_instance->create_builtin_annotations();
     }
     return g_instance;
 }
 
+namespace {
+
+/**
+ * Names registered by register_builtin_annotations_types.
+ * Looking up one of them is what triggers the registration of the builtin annotations.
+ */
+bool is_builtin_annotation_name(
+        const std::string& type_name)
+{
+    static const std::unordered_set<std::string> builtin_annotation_names = {
+        "id", "autoid", "AutoidKind", "optional", "position", "value", "extensibility", "ExtensibilityKind",
+        "final", "appendable", "mutable", "key", "Key", "must_understand", "default_literal", "default", "range",
+        "min", "max", "unit", "bit_bound", "external", "nested", "verbatim", "PlacementKind", "service", "oneway",
+        "ami", "non_serialized"
+    };
+
+    return builtin_annotation_names.count(type_name) > 0;
+}
+
+/**
+ * Key of hashed_identifiers_ for an EK_MINIMAL or EK_COMPLETE TypeIdentifier.
+ */
+std::string hashed_identifier_key(
+        const TypeIdentifier& identifier)
+{
+    std::string key(1 + sizeof(EquivalenceHash), static_cast<char>(identifier._d()));
+    memcpy(&key[1], identifier.equivalence_hash(), sizeof(EquivalenceHash));
+    return key;
+}
+
+} // namespace
+
 ReturnCode_t TypeObjectFactory::delete_instance()
 {
     if (g_instance != nullptr)
@@ -194,9 +227,32 @@ TypeObjectFactory::~TypeObjectFactory()
     }
 }
 
-void TypeObjectFactory::create_builtin_annotations()
+void TypeObjectFactory::create_builtin_annotations() const
+{
+    if (builtin_annotations_created_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    // Both locks are kept during the whole registration, so lookups from other threads wait for it to finish.
+    std::unique_lock<std::recursive_mutex> scopedObj(m_MutexObjects, std::defer_lock);
+    std::unique_lock<std::recursive_mutex> scopedIds(m_MutexIdentifiers, std::defer_lock);
+    std::lock(scopedObj, scopedIds);
+    if (!builtin_annotations_created_.load(std::memory_order_relaxed))
+    {
+        // Set before registering, as the registration looks up the builtin annotations itself.
+        builtin_annotations_created_.store(true, std::memory_order_release);
+        register_builtin_annotations_types(const_cast<TypeObjectFactory*>(this));
+    }
+}
+
+void TypeObjectFactory::create_builtin_annotations_if_needed(
+        const std::string& type_name) const
 {
-    register_builtin_annotations_types(g_instance);
+    if (!builtin_annotations_created_.load(std::memory_order_acquire) && is_builtin_annotation_name(type_name))
+    {
+        create_builtin_annotations();
+    }
 }
 
 void TypeObjectFactory::nullify_all_entries(
@@ -880,16 +936,18 @@ const TypeObject* TypeObjectFactory::get_type_object(
     }
     if (identifier->_d() == EK_COMPLETE)
     {
-        if (complete_objects_.find(identifier) != complete_objects_.end())
+        auto it = complete_objects_.find(identifier);
+        if (it != complete_objects_.end())
         {
-            return complete_objects_.at(identifier);
+            return it->second;
         }
     }
     else
     {
-        if (objects_.find(identifier) != objects_.end())
+        auto it = objects_.find(identifier);
+        if (it != objects_.end())
         {
-            return objects_.at(identifier);
+            return it->second;
         }
     }
 
@@ -1068,13 +1126,16 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier(
         const std::string& type_name,
         bool complete) const
 {
+    create_builtin_annotations_if_needed(type_name);
+
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
 
     if (complete)
     {
-        if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
+        auto it = complete_identifiers_.find(type_name);
+        if (it != complete_identifiers_.end())
         {
-            return complete_identifiers_.at(type_name);
+            return it->second;
         }
         /*else // Try it with minimal
            {
@@ -1083,16 +1144,18 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier(
     }
     else
     {
-        if (identifiers_.find(type_name) != identifiers_.end())
+        auto it = identifiers_.find(type_name);
+        if (it != identifiers_.end())
         {
-            return identifiers_.at(type_name);
+            return it->second;
         }
     }
 
     // Try with aliases
-    if (aliases_.find(type_name) != aliases_.end())
+    auto alias_it = aliases_.find(type_name);
+    if (alias_it != aliases_.end())
     {
-        return get_type_identifier(aliases_.at(type_name), complete);
+        return get_type_identifier(alias_it->second, complete);
     }
 
     return nullptr;
@@ -1101,11 +1164,14 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier(
 const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(
         const std::string& type_name) const
 {
+    create_builtin_annotations_if_needed(type_name);
+
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
 
-    if (complete_identifiers_.find(type_name) != complete_identifiers_.end())
+    auto it = complete_identifiers_.find(type_name);
+    if (it != complete_identifiers_.end())
     {
-        return complete_identifiers_.at(type_name);
+        return it->second;
     }
     else // Try it with minimal
     {
@@ -1115,20 +1181,34 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(
 
 const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(
         const TypeIdentifier* identifier) const
+{
+    const TypeIdentifier* stored = find_stored_type_identifier(identifier);
+
+    // An unknown hash may belong to one of the builtin annotations, which are registered on demand
+    if (stored == nullptr && identifier != nullptr && identifier->_d() >= EK_MINIMAL &&
+            !builtin_annotations_created_.load(std::memory_order_acquire))
+    {
+        create_builtin_annotations();
+        stored = find_stored_type_identifier(identifier);
+    }
+
+    return stored;
+}
+
+const TypeIdentifier* TypeObjectFactory::find_stored_type_identifier(
+        const TypeIdentifier* identifier) const
 {
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr)
     {
         return nullptr;
     }
-    if (identifier->_d() == EK_COMPLETE)
+    if (identifier->_d() == EK_COMPLETE || identifier->_d() == EK_MINIMAL)
     {
-        for (auto& it : complete_identifiers_)
+        auto it = hashed_identifiers_.find(hashed_identifier_key(*identifier));
+        if (it != hashed_identifiers_.end())
         {
-            if (*(it.second) == *identifier)
-            {
-                return it.second;
-            }
+            return it->second;
         }
     }
     else
@@ -1338,7 +1418,8 @@ void TypeObjectFactory::add_type_identifier(
         const std::string& type_name,
         const TypeIdentifier* identifier)
 {
-    const TypeIdentifier* alreadyExists = get_stored_type_identifier(identifier);
+    // Registering a type must not trigger the registration of the builtin annotations
+    const TypeIdentifier* alreadyExists = find_stored_type_identifier(identifier);
     if (alreadyExists != nullptr && alreadyExists != identifier)
     {
         // Don't copy
@@ -1363,6 +1444,10 @@ void TypeObjectFactory::add_type_identifier(
             identifiers_created_.push_back(id);
             *id = *identifier;
             complete_identifiers_[type_name] = id;
+            if (identifier->_d() == EK_COMPLETE)
+            {
+                hashed_identifiers_[hashed_identifier_key(*id)] = id;
+            }
         }
     }
     else
@@ -1373,6 +1458,10 @@ void TypeObjectFactory::add_type_identifier(
             identifiers_created_.push_back(id);
             *id = *identifier;
             identifiers_[type_name] = id;
+            if (identifier->_d() == EK_MINIMAL)
+            {
+                hashed_identifiers_[hashed_identifier_key(*id)] = id;
+            }
         }
     }
 }
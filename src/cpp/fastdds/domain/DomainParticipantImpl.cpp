@@ -65,6 +65,7 @@
 #include <fastdds/topic/TopicProxyFactory.hpp>
 #include <fastdds/utils/QosConverters.hpp>
 #include <rtps/RTPSDomainImpl.hpp>
+#include <utils/StartupPhaseTimer.hpp>
 #include <utils/SystemInfo.hpp>
 
 namespace eprosima {
@@ -260,9 +261,12 @@ ReturnCode_t DomainParticipantImpl::enable()
     // Should not have failed assigning the GUID
     assert (guid_ != GUID_t::unknown());
 
+    StartupPhaseTimer startup_timer("DomainParticipant");
+
     fastrtps::rtps::RTPSParticipantAttributes rtps_attr;
     utils::set_attributes_from_qos(rtps_attr, qos_);
     rtps_attr.participantID = participant_id_;
+    startup_timer.phase_finished("qos");
 
     // If DEFAULT_ROS2_MASTER_URI is specified then try to create default client if
     // that already exists.
@@ -284,6 +288,7 @@ ReturnCode_t DomainParticipantImpl::enable()
     }
 
     guid_ = part->getGuid();
+    startup_timer.phase_finished("rtps_participant");
 
     {
         std::lock_guard<std::mutex> _(mtx_gs_);
@@ -329,9 +334,12 @@ ReturnCode_t DomainParticipantImpl::enable()
                 sub.second->user_subscriber_->enable();
             }
         }
+        startup_timer.phase_finished("entities");
     }
 
     part->enable();
+    startup_timer.phase_finished("discovery_start");
+    startup_timer.report();
 
     return ReturnCode_t::RETCODE_OK;
 }
@@ -2164,6 +2172,22 @@ bool DomainParticipantImpl::set_qos(
     {
         to.name() = from.name();
     }
+    if (first_time && !(to.timed_events_thread() == from.timed_events_thread()))
+    {
+        to.timed_events_thread() = from.timed_events_thread();
+    }
+    if (first_time && !(to.discovery_server_thread() == from.discovery_server_thread()))
+    {
+        to.discovery_server_thread() = from.discovery_server_thread();
+    }
+    if (first_time && !(to.builtin_controllers_sender_thread() == from.builtin_controllers_sender_thread()))
+    {
+        to.builtin_controllers_sender_thread() = from.builtin_controllers_sender_thread();
+    }
+    if (first_time && !(to.data_sharing_listener_thread() == from.data_sharing_listener_thread()))
+    {
+        to.data_sharing_listener_thread() = from.data_sharing_listener_thread();
+    }
 
     return qos_should_be_updated;
 }
@@ -2300,6 +2324,30 @@ bool DomainParticipantImpl::can_qos_be_updated(
         updatable = false;
         EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK, "Participant name cannot be changed after the participant is enabled");
     }
+    if (!(to.timed_events_thread() == from.timed_events_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant timed_events_thread cannot be changed after the participant is enabled");
+    }
+    if (!(to.discovery_server_thread() == from.discovery_server_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant discovery_server_thread cannot be changed after the participant is enabled");
+    }
+    if (!(to.builtin_controllers_sender_thread() == from.builtin_controllers_sender_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant builtin_controllers_sender_thread cannot be changed after the participant is enabled");
+    }
+    if (!(to.data_sharing_listener_thread() == from.data_sharing_listener_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant data_sharing_listener_thread cannot be changed after the participant is enabled");
+    }
     return updatable;
 }
 
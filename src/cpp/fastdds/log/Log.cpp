@@ -26,6 +26,7 @@
 #include <fastdds/dds/log/StdoutErrConsumer.hpp>
 #include <fastdds/dds/log/Colors.hpp>
 #include <utils/SystemInfo.hpp>
+#include <utils/threading.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -238,6 +239,14 @@ struct LogResources
         }
     }
 
+    //! Sets the settings applied to the logging thread when it is launched.
+    void SetThreadConfig(
+            const rtps::ThreadSettings& config)
+    {
+        std::lock_guard<std::mutex> guard(cv_mutex_);
+        thread_settings_ = config;
+    }
+
 private:
 
     void StartThread()
@@ -246,7 +255,12 @@ private:
         if (!logging_ && !logging_thread_)
         {
             logging_ = true;
-            logging_thread_.reset(new std::thread(&LogResources::run, this));
+            rtps::ThreadSettings thread_settings = thread_settings_;
+            logging_thread_.reset(new std::thread([this, thread_settings]()
+                    {
+                        configure_current_thread(thread_settings, "dds.log", 0);
+                        run();
+                    }));
         }
     }
 
@@ -332,6 +346,7 @@ private:
     bool logging_;
     bool work_;
     int current_loop_;
+    rtps::ThreadSettings thread_settings_;
 
     // Context configuration.
     std::mutex config_mutex_;
@@ -391,6 +406,12 @@ void Log::KillThread()
     detail::get_log_resources()->KillThread();
 }
 
+void Log::SetThreadConfig(
+        const rtps::ThreadSettings& config)
+{
+    detail::get_log_resources()->SetThreadConfig(config);
+}
+
 void Log::QueueLog(
         const std::string& message,
         const Log::Context& context,
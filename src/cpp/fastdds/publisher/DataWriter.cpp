@@ -19,7 +19,9 @@
 
 #include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/publisher/DataWriterImpl.hpp>
+#include <fastdds/subscriber/DataReaderImpl.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -117,6 +119,34 @@ ReturnCode_t DataWriter::write_w_timestamp(
     return ReturnCode_t::RETCODE_UNSUPPORTED;
 }
 
+ReturnCode_t DataWriter::write_batch(
+        const std::vector<void*>& data)
+{
+    return impl_->write_batch(data);
+}
+
+ReturnCode_t DataWriter::write_serialized(
+        const fastrtps::rtps::SerializedPayload_t& payload,
+        const InstanceHandle_t& handle)
+{
+    return impl_->write_serialized(payload, handle, nullptr);
+}
+
+ReturnCode_t DataWriter::forward(
+        DataReader* reader,
+        const fastrtps::rtps::SerializedPayload_t& payload,
+        const InstanceHandle_t& handle)
+{
+    if (nullptr == reader)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    DataWriterImpl::ForwardedPayloadSource source;
+    source.pool = reader->impl_->get_shareable_payload_pool(payload, source.owner, source.memory_policy);
+    return impl_->write_serialized(payload, handle, source.pool ? &source : nullptr);
+}
+
 InstanceHandle_t DataWriter::register_instance(
         void* instance)
 {
@@ -20,6 +20,7 @@
 
 #include <fastdds/publisher/DataWriterImpl.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 
@@ -438,6 +439,13 @@ DataWriterImpl::~DataWriterImpl()
         EPROSIMA_LOG_INFO(DATA_WRITER, guid().entityId << " in topic: " << type_->getName());
         RTPSDomain::removeRTPSWriter(writer_);
         release_payload_pool();
+
+        // Every forwarded payload has been released together with the history
+        for (ForwardedPool& forwarded : forwarded_pools_)
+        {
+            forwarded.pool->release_history(forwarded.config, false);
+        }
+        forwarded_pools_.clear();
     }
 
     delete user_datawriter_;
@@ -622,6 +630,64 @@ ReturnCode_t DataWriterImpl::write(
     return ret;
 }
 
+ReturnCode_t DataWriterImpl::write_batch(
+        const std::vector<void*>& data)
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    // Check every sample and calculate its instance before taking the writer mutex
+    std::vector<InstanceHandle_t> handles(data.size());
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        ReturnCode_t ret = check_new_change_preconditions(ALIVE, data[i]);
+        if (!ret)
+        {
+            return ret;
+        }
+
+        ret = check_write_preconditions(data[i], HANDLE_NIL, handles[i]);
+        if (!ret)
+        {
+            return ret;
+        }
+    }
+
+    EPROSIMA_LOG_INFO(DATA_WRITER, "Writing batch of " << data.size() << " samples");
+
+    auto max_blocking_time = steady_clock::now() +
+            microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+
+#if HAVE_STRICT_REALTIME
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    // Samples delivered while the batch is open are packed on the same messages
+    bool is_batch_open = writer_->begin_sample_batch_nts(max_blocking_time);
+
+    ReturnCode_t ret = ReturnCode_t::RETCODE_OK;
+    for (size_t i = 0; i < data.size() && ReturnCode_t::RETCODE_OK == ret; ++i)
+    {
+        WriteParams wparams;
+        ret = create_new_change_nts(ALIVE, data[i], wparams, handles[i], lock, max_blocking_time);
+    }
+
+    if (is_batch_open)
+    {
+        writer_->end_sample_batch_nts();
+    }
+
+    return ret;
+}
+
 ReturnCode_t DataWriterImpl::write_w_timestamp(
         void* data,
         const InstanceHandle_t& handle,
@@ -650,6 +716,148 @@ ReturnCode_t DataWriterImpl::write_w_timestamp(
     return ret;
 }
 
+ReturnCode_t DataWriterImpl::write_serialized(
+        const SerializedPayload_t& payload,
+        const InstanceHandle_t& handle,
+        const ForwardedPayloadSource* source)
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    if ((nullptr == payload.data) || (0 == payload.length))
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    InstanceHandle_t instance_handle = handle;
+    if (type_->m_isGetKeyDefined)
+    {
+        // A given handle is only checked on debug builds, as that requires deserializing the sample
+#if defined(NDEBUG)
+        if (!handle.isDefined())
+#endif // if defined(NDEBUG)
+        {
+            // The key can only be deduced from the deserialized sample
+            void* sample = type_->createData();
+            bool deserialized = type_->deserialize(const_cast<SerializedPayload_t*>(&payload), sample);
+            if (deserialized)
+            {
+                bool is_key_protected = false;
+#if HAVE_SECURITY
+                is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
+#endif // if HAVE_SECURITY
+                type_->getKey(sample, &instance_handle, is_key_protected);
+            }
+            type_->deleteData(sample);
+
+            if (!deserialized)
+            {
+                EPROSIMA_LOG_WARNING(DATA_WRITER, "Could not deduce the instance of a serialized sample");
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+        }
+
+#if !defined(NDEBUG)
+        if (handle.isDefined() && instance_handle != handle)
+        {
+            EPROSIMA_LOG_ERROR(DATA_WRITER, "handle differs from the key of the serialized sample.");
+            return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+        }
+#endif // if !defined(NDEBUG)
+    }
+
+    auto max_blocking_time = steady_clock::now() +
+            microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+
+#if HAVE_STRICT_REALTIME
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    PayloadInfo_t payload_info;
+
+    // Data-sharing writers need the payloads on their own segment
+    if ((nullptr != source) && !is_data_sharing_compatible_ && reserve_forwarded_pool(*source))
+    {
+        // Take a new reference to the buffer of the reader's pool instead of copying it
+        CacheChange_t change;
+        change.writerGUID = guid();
+        change.sequenceNumber = history_.next_sequence_number();
+        IPayloadPool* owner = source->owner;
+        if (!owner->get_payload(const_cast<SerializedPayload_t&>(payload), owner, change))
+        {
+            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+        }
+        change.serializedPayload.encapsulation = payload.encapsulation;
+        payload_info.move_from_change(change);
+    }
+    else
+    {
+        uint32_t size = payload.length;
+        if (!get_free_payload_from_pool([size]()
+                {
+                    return size;
+                }, payload_info))
+        {
+            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+        }
+
+        if (!payload_info.payload.copy(&payload, true))
+        {
+            return_payload_to_pool(payload_info);
+            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+        }
+    }
+
+    EPROSIMA_LOG_INFO(DATA_WRITER, "Writing serialized data");
+    WriteParams wparams;
+    ReturnCode_t ret = add_new_change(ALIVE, payload_info, wparams, instance_handle, lock, max_blocking_time);
+    if (!ret)
+    {
+        return_payload_to_pool(payload_info);
+    }
+
+    return ret;
+}
+
+bool DataWriterImpl::reserve_forwarded_pool(
+        const ForwardedPayloadSource& source)
+{
+    // Changes on the pool of this writer are already accounted by its own reservation
+    if (source.pool == payload_pool_)
+    {
+        return true;
+    }
+
+    auto same_pool = [&source](const ForwardedPool& forwarded)
+            {
+                return forwarded.pool == source.pool;
+            };
+    if (forwarded_pools_.end() != std::find_if(forwarded_pools_.begin(), forwarded_pools_.end(), same_pool))
+    {
+        return true;
+    }
+
+    // Allow as many payloads as this writer's history can hold, without preallocating them
+    ForwardedPool forwarded{source.pool, PoolConfig::from_history_attributes(history_.m_att)};
+    forwarded.config.memory_policy = source.memory_policy;
+    forwarded.config.initial_size = 0;
+    if (!forwarded.pool->reserve_history(forwarded.config, false))
+    {
+        return false;
+    }
+
+    forwarded_pools_.push_back(forwarded);
+    return true;
+}
+
 ReturnCode_t DataWriterImpl::check_instance_preconditions(
         void* data,
         const InstanceHandle_t& handle,
@@ -929,23 +1137,124 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
     std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
+    return create_new_change_nts(change_kind, data, wparams, handle, lock, max_blocking_time);
+}
+
+ReturnCode_t DataWriterImpl::create_new_change_nts(
+        ChangeKind_t change_kind,
+        void* data,
+        WriteParams& wparams,
+        const InstanceHandle_t& handle,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
     PayloadInfo_t payload;
     bool was_loaned = check_and_remove_loan(data, payload);
     if (!was_loaned)
     {
-        if (!get_free_payload_from_pool(type_->getSerializedSizeProvider(data), payload))
+        ReturnCode_t ret = ReturnCode_t::RETCODE_OK;
+        if (ALIVE == change_kind)
+        {
+            ret = serialize_into_pool_payload(data, payload);
+        }
+        else if (!get_free_payload_from_pool(type_->getSerializedSizeProvider(data), payload))
+        {
+            ret = ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+        }
+
+        if (!ret)
+        {
+            return ret;
+        }
+    }
+
+    ReturnCode_t ret = add_new_change(change_kind, payload, wparams, handle, lock, max_blocking_time);
+    if (!ret)
+    {
+        if (was_loaned)
+        {
+            add_loan(data, payload);
+        }
+        else
+        {
+            return_payload_to_pool(payload);
+        }
+    }
+
+    return ret;
+}
+
+ReturnCode_t DataWriterImpl::serialize_into_pool_payload(
+        void* data,
+        PayloadInfo_t& payload)
+{
+    // Samples with a fixed payload size serialize in a single pass. With a size hint, the sample is serialized on a
+    // payload of that size, and its serialized size is only calculated when it does not fit. Otherwise, the payload
+    // is sized after the serialized size of the sample.
+    uint32_t size_hint = fixed_payload_size_ ? fixed_payload_size_ : serialized_size_hint_;
+    if (0 != size_hint)
+    {
+        if (!get_free_payload_from_pool([size_hint]()
+                {
+                    return size_hint;
+                }, payload))
         {
             return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
         }
 
-        if ((ALIVE == change_kind) && !type_->serialize(data, &payload.payload))
+        if (type_->serialize(data, &payload.payload))
+        {
+            if (0 == fixed_payload_size_)
+            {
+                // Decay the hint towards the size of the last samples, so a single large sample does not make all
+                // the following ones take buffers of its size. The payload may be larger than the hint.
+                uint32_t length = payload.payload.length;
+                serialized_size_hint_ = length < serialized_size_hint_ ?
+                        serialized_size_hint_ - (serialized_size_hint_ - length) / 8 : length;
+            }
+            return ReturnCode_t::RETCODE_OK;
+        }
+
+        return_payload_to_pool(payload);
+
+        if (0 != fixed_payload_size_)
         {
             EPROSIMA_LOG_WARNING(DATA_WRITER, "Data serialization returned false");
-            return_payload_to_pool(payload);
             return ReturnCode_t::RETCODE_ERROR;
         }
     }
 
+    uint32_t size = type_->getSerializedSizeProvider(data)();
+    if (!get_free_payload_from_pool([size]()
+            {
+                return size;
+            }, payload))
+    {
+        return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+    }
+
+    if (!type_->serialize(data, &payload.payload))
+    {
+        EPROSIMA_LOG_WARNING(DATA_WRITER, "Data serialization returned false");
+        return_payload_to_pool(payload);
+        return ReturnCode_t::RETCODE_ERROR;
+    }
+
+    if (use_serialized_size_hint_)
+    {
+        serialized_size_hint_ = std::max(serialized_size_hint_, size);
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t DataWriterImpl::add_new_change(
+        ChangeKind_t change_kind,
+        PayloadInfo_t& payload,
+        WriteParams& wparams,
+        const InstanceHandle_t& handle,
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        const steady_clock::time_point& max_blocking_time)
+{
     CacheChange_t* ch = writer_->new_change(change_kind, handle);
     if (ch != nullptr)
     {
@@ -969,11 +1278,7 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
 
         if (!added)
         {
-            if (was_loaned)
-            {
-                payload.move_from_change(*ch);
-                add_loan(data, payload);
-            }
+            payload.move_from_change(*ch);
             writer_->release_change(ch);
             return ReturnCode_t::RETCODE_TIMEOUT;
         }
@@ -1904,8 +2209,15 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
 
         PoolConfig config = PoolConfig::from_history_attributes(history_.m_att);
 
-        // Avoid calling the serialization size functors on PREALLOCATED mode
+        // Avoid calling the serialization size functors on PREALLOCATED mode.
+        // PREALLOCATED_WITH_REALLOC pools, only used here by unbounded types, never shrink their payloads, so
+        // samples are first serialized on a payload sized after the last samples, as long as the type does not
+        // write beyond a payload too small for the sample. DYNAMIC pools allocate the requested size on every
+        // payload, so they keep asking for the exact serialized size of each sample.
         fixed_payload_size_ = config.memory_policy == PREALLOCATED_MEMORY_MODE ? config.payload_initial_size : 0u;
+        use_serialized_size_hint_ = config.memory_policy == PREALLOCATED_WITH_REALLOC_MEMORY_MODE &&
+                type_->serialize_checks_bounds();
+        serialized_size_hint_ = 0u;
 
         // Get payload pool reference and allocate space for our history
         if (is_data_sharing_compatible_)
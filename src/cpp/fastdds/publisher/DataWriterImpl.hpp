@@ -20,6 +20,7 @@
 #define _FASTRTPS_DATAWRITERIMPL_HPP_
 
 #include <memory>
+#include <vector>
 
 #include <fastdds/dds/core/status/BaseStatus.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
@@ -120,6 +121,17 @@ protected:
 
 public:
 
+    //! Payload pool of a DataReader holding a serialized payload that can be forwarded without copying it
+    struct ForwardedPayloadSource
+    {
+        //! Pool of the DataReader, which keeps the buffer of the payload alive
+        std::shared_ptr<fastrtps::rtps::ITopicPayloadPool> pool;
+        //! Pool set as owner of the buffer of the payload
+        fastrtps::rtps::IPayloadPool* owner = nullptr;
+        //! Memory policy of @c pool
+        fastrtps::rtps::MemoryManagementPolicy_t memory_policy = fastrtps::rtps::PREALLOCATED_MEMORY_MODE;
+    };
+
     virtual ~DataWriterImpl();
 
     /**
@@ -202,6 +214,19 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * @brief Implementation of the `write_batch` operation.
+     * All the samples are added to the history under a single lock of the writer, and the ones sent synchronously
+     * are packed together on the same RTPS messages.
+     *
+     * @param[in] data  Pointers to the samples to publish.
+     *
+     * @return RETCODE_OK when all the samples were written, or the error of the first sample that could not be
+     * written. Samples before that one remain written.
+     */
+    ReturnCode_t write_batch(
+            const std::vector<void*>& data);
+
     /**
      * @brief Implementation of the DDS `write_w_timestamp` operation.
      *
@@ -217,6 +242,22 @@ public:
             const InstanceHandle_t& handle,
             const fastrtps::Time_t& timestamp);
 
+    /**
+     * @brief Implementation of the `write_serialized` and `forward` operations.
+     *
+     * @param[in] payload     Serialized sample to publish.
+     * @param[in] handle      Handle of the instance to update. The special value @c HANDLE_NIL can be used to indicate
+     *                        that the instance should be calculated from the deserialized sample.
+     * @param[in] source      Payload pool holding the buffer of @c payload, which will be shared when possible.
+     *                        When nullptr, the payload is copied.
+     *
+     * @return any of the standard return codes.
+     */
+    ReturnCode_t write_serialized(
+            const fastrtps::rtps::SerializedPayload_t& payload,
+            const InstanceHandle_t& handle,
+            const ForwardedPayloadSource* source);
+
     /**
      * @brief Implementation of the DDS `register_instance` operation.
      * It deduces the instance's key and tries to get resources in the DataWriterHistory.
@@ -486,8 +527,30 @@ protected:
 
     uint32_t fixed_payload_size_ = 0u;
 
+    //! Whether samples are serialized on payloads of serialized_size_hint_ before calculating their size.
+    //! Only for types whose serialize checks the payload bounds.
+    bool use_serialized_size_hint_ = false;
+
+    /**
+     * Payload size tried first for samples of unbounded types on PREALLOCATED_WITH_REALLOC pools.
+     * It grows to the size of any sample that does not fit, and decays towards the size of the samples that do.
+     * As the pool keeps the largest size each payload has been given, this may leave up to the history depth of
+     * payloads sized after a recent large sample.
+     */
+    uint32_t serialized_size_hint_ = 0u;
+
     std::shared_ptr<IPayloadPool> payload_pool_;
 
+    //! Payload pool of a DataReader whose payloads have been forwarded, and the reservation made on it
+    struct ForwardedPool
+    {
+        std::shared_ptr<ITopicPayloadPool> pool;
+        fastrtps::rtps::PoolConfig config;
+    };
+
+    //! Payload pools of DataReaders whose payloads have been forwarded, kept until the history is released
+    std::vector<ForwardedPool> forwarded_pools_;
+
     std::unique_ptr<LoanCollection> loans_;
 
     fastrtps::rtps::GUID_t guid_;
@@ -579,6 +642,73 @@ protected:
             fastrtps::rtps::WriteParams& wparams,
             const InstanceHandle_t& handle);
 
+    /**
+     * Serialize a sample, or take its loaned payload, and add a new change with it to the history.
+     * Should be called with the writer mutex locked.
+     *
+     * @param change_kind        Kind of the change.
+     * @param data               Sample of the change.
+     * @param wparams            Extra write parameters.
+     * @param handle             Handle of the instance the change belongs to.
+     * @param lock               Lock held on the writer mutex.
+     * @param max_blocking_time  Maximum time to wait for space on the history.
+     *
+     * @return any of the standard return codes.
+     */
+    ReturnCode_t create_new_change_nts(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            void* data,
+            fastrtps::rtps::WriteParams& wparams,
+            const InstanceHandle_t& handle,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Ensure that the changes of this writer are accounted on the payload pool of a DataReader, so the payloads
+     * forwarded from it do not exhaust the pool nor prevent it from shrinking when the DataReader is deleted.
+     * Should be called with the writer mutex locked.
+     *
+     * @param source  Pool of the DataReader.
+     *
+     * @return true when payloads of @c source can be shared by the changes of this writer.
+     */
+    bool reserve_forwarded_pool(
+            const ForwardedPayloadSource& source);
+
+    /**
+     * Get a payload from the pool and serialize a sample on it.
+     * Should be called with the writer mutex locked.
+     *
+     * @param data     Sample to serialize.
+     * @param payload  Payload where the sample is serialized.
+     *
+     * @return any of the standard return codes.
+     */
+    ReturnCode_t serialize_into_pool_payload(
+            void* data,
+            PayloadInfo_t& payload);
+
+    /**
+     * Create a change holding an already filled payload and add it to the history.
+     * Should be called with the writer mutex locked.
+     *
+     * @param change_kind        Kind of the change.
+     * @param payload            Payload of the change. It is left untouched when an error is returned.
+     * @param wparams            Extra write parameters.
+     * @param handle             Handle of the instance the change belongs to.
+     * @param lock               Lock held on the writer mutex.
+     * @param max_blocking_time  Maximum time to wait for space on the history.
+     *
+     * @return any of the standard return codes.
+     */
+    ReturnCode_t add_new_change(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            PayloadInfo_t& payload,
+            fastrtps::rtps::WriteParams& wparams,
+            const InstanceHandle_t& handle,
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
     static fastrtps::TopicAttributes get_topic_attributes(
             const DataWriterQos& qos,
             const Topic& topic,
@@ -680,9 +810,11 @@ protected:
     void return_payload_to_pool(
             PayloadInfo_t& payload)
     {
+        // Forwarded payloads are owned by the pool of the DataReader they come from
+        IPayloadPool* owner = payload.payload_owner;
         CacheChange_t change;
         payload.move_into_change(change);
-        payload_pool_->release_payload(change);
+        owner->release_payload(change);
     }
 
     bool add_loan(
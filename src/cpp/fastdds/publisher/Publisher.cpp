@@ -66,6 +66,16 @@ ReturnCode_t Publisher::enable()
     return ret_code;
 }
 
+ReturnCode_t Publisher::enable_datawriters()
+{
+    if (!enable_)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    return impl_->enable_datawriters();
+}
+
 const PublisherQos& Publisher::get_qos() const
 {
     return impl_->get_qos();
@@ -22,6 +22,7 @@
 #include <fastdds/domain/DomainParticipantImpl.hpp>
 #include <fastdds/topic/TopicDescriptionImpl.hpp>
 
+#include <fastdds/utils/ParallelEnabler.hpp>
 #include <fastdds/utils/QosConverters.hpp>
 
 #include <fastdds/dds/publisher/Publisher.hpp>
@@ -84,6 +85,27 @@ ReturnCode_t PublisherImpl::enable()
     return ReturnCode_t::RETCODE_OK;
 }
 
+ReturnCode_t PublisherImpl::enable_datawriters()
+{
+    std::vector<DataWriter*> disabled_writers;
+    {
+        std::lock_guard<std::mutex> lock(mtx_writers_);
+        for (auto& topic_writers : writers_)
+        {
+            for (DataWriterImpl* dw : topic_writers.second)
+            {
+                if (!dw->user_datawriter_->is_enabled())
+                {
+                    disabled_writers.push_back(dw->user_datawriter_);
+                }
+            }
+        }
+    }
+
+    // The lock is not kept, as enabling an endpoint may call back the user listeners
+    return utils::enable_in_parallel(disabled_writers);
+}
+
 void PublisherImpl::disable()
 {
     set_listener(nullptr);
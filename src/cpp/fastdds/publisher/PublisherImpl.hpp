@@ -86,6 +86,8 @@ public:
 
     ReturnCode_t enable();
 
+    ReturnCode_t enable_datawriters();
+
     const PublisherQos& get_qos() const;
 
     ReturnCode_t set_qos(
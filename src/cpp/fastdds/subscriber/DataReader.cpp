@@ -272,6 +272,30 @@ ReturnCode_t DataReader::take_next_sample(
     return impl_->take_next_sample(data, info);
 }
 
+ReturnCode_t DataReader::read_serialized(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->read_serialized(data_values, sample_infos, max_samples, sample_states, view_states,
+                   instance_states);
+}
+
+ReturnCode_t DataReader::take_serialized(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->take_serialized(data_values, sample_infos, max_samples, sample_states, view_states,
+                   instance_states);
+}
+
 ReturnCode_t DataReader::get_first_untaken_info(
         SampleInfo* info)
 {
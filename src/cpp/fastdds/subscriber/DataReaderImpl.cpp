@@ -88,6 +88,13 @@ static bool qos_has_unique_network_request(
     return nullptr != PropertyPolicyHelper::find_property(qos.properties(), "fastdds.unique_network_flows");
 }
 
+static bool qos_has_deserialize_outside_lock(
+        const DataReaderQos& qos)
+{
+    const std::string* value = PropertyPolicyHelper::find_property(qos.properties(), "fastdds.deserialize_outside_lock");
+    return (nullptr != value) && ("true" == *value);
+}
+
 static bool qos_has_specific_locators(
         const DataReaderQos& qos)
 {
@@ -143,6 +150,7 @@ ReturnCode_t DataReaderImpl::enable()
     att.endpoint.ignore_non_matching_locators = qos_.endpoint().ignore_non_matching_locators;
     att.endpoint.properties = qos_.properties();
     att.endpoint.ownershipKind = qos_.ownership().kind;
+    deserialize_outside_lock_ = qos_has_deserialize_outside_lock(qos_);
     att.endpoint.setEntityID(qos_.endpoint().entity_id);
     att.endpoint.setUserDefinedID(qos_.endpoint().user_defined_id);
     att.times = qos_.reliable_reader_qos().times;
@@ -481,7 +489,8 @@ ReturnCode_t DataReaderImpl::read_or_take(
         InstanceStateMask instance_states,
         bool exact_instance,
         bool single_instance,
-        bool should_take)
+        bool should_take,
+        bool serialized)
 {
     if (reader_ == nullptr)
     {
@@ -504,7 +513,7 @@ ReturnCode_t DataReaderImpl::read_or_take(
         return ReturnCode_t::RETCODE_TIMEOUT;
     }
 #else
-    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
     set_read_communication_status(false);
@@ -539,6 +548,26 @@ ReturnCode_t DataReaderImpl::read_or_take(
         single_instance,
         !exact_instance);
 
+    if (serialized)
+    {
+        cmd.serialized_payloads();
+    }
+
+    // Taken samples are deserialized without holding the reader mutex, so other threads taking from different
+    // instances, and the reception path, are not blocked by the deserialization.
+    DeferredChanges deferred;
+    bool defer_deserialization = deserialize_outside_lock_ && should_take && data_values.has_ownership() &&
+            !serialized;
+    if (defer_deserialization)
+    {
+        if (!deferred_changes_pool_.empty())
+        {
+            deferred.swap(deferred_changes_pool_.back());
+            deferred_changes_pool_.pop_back();
+        }
+        cmd.defer_deserialization(deferred);
+    }
+
     while (!cmd.is_finished())
     {
         cmd.add_instance(should_take);
@@ -546,7 +575,47 @@ ReturnCode_t DataReaderImpl::read_or_take(
 
     try_notify_read_conditions();
 
-    return cmd.return_value();
+    code = cmd.return_value();
+
+    if (defer_deserialization)
+    {
+        if (!deferred.empty())
+        {
+            deserialize_deferred_changes(lock, data_values, sample_infos, deferred);
+        }
+        deferred_changes_pool_.emplace_back(std::move(deferred));
+    }
+
+    return code;
+}
+
+void DataReaderImpl::deserialize_deferred_changes(
+        std::unique_lock<RecursiveTimedMutex>& lock,
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        DeferredChanges& deferred)
+{
+    // The changes have already been removed from the history, so they can be safely accessed without the mutex.
+    lock.unlock();
+
+    for (auto& item : deferred)
+    {
+        if (!type_->deserialize(&item.second->serializedPayload, data_values.buffer()[item.first]))
+        {
+            EPROSIMA_LOG_WARNING(SUBSCRIBER, "Error deserializing change " << item.second->sequenceNumber
+                                                                           << " from " << item.second->writerGUID);
+            sample_infos[item.first].valid_data = false;
+        }
+    }
+
+    lock.lock();
+
+    for (auto& item : deferred)
+    {
+        reader_->releaseCache(item.second);
+    }
+
+    deferred.clear();
 }
 
 ReturnCode_t DataReaderImpl::read(
@@ -625,6 +694,54 @@ ReturnCode_t DataReaderImpl::take_next_instance(
                    sample_states, view_states, instance_states, false, true, true);
 }
 
+ReturnCode_t DataReaderImpl::read_serialized(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return read_or_take(data_values, sample_infos, max_samples, HANDLE_NIL,
+                   sample_states, view_states, instance_states, false, false, false, true);
+}
+
+ReturnCode_t DataReaderImpl::take_serialized(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return read_or_take(data_values, sample_infos, max_samples, HANDLE_NIL,
+                   sample_states, view_states, instance_states, false, false, true, true);
+}
+
+std::shared_ptr<ITopicPayloadPool> DataReaderImpl::get_shareable_payload_pool(
+        const SerializedPayload_t& payload,
+        IPayloadPool*& owner,
+        MemoryManagementPolicy_t& memory_policy)
+{
+    if (reader_ == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+
+    // Payloads received through data-sharing live on the writer's segment, so only those on the payload pool of
+    // the reader can be shared.
+    owner = sample_pool_->serialized_loan_owner(&payload);
+    if ((nullptr == owner) || !payload_pool_->is_payload_owner(owner))
+    {
+        return nullptr;
+    }
+
+    memory_policy = history_.m_att.memoryPolicy;
+    return payload_pool_;
+}
+
 ReturnCode_t DataReaderImpl::return_loan(
         LoanableCollection& data_values,
         SampleInfoSeq& sample_infos)
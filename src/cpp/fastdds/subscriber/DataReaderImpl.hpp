@@ -22,6 +22,8 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/core/LoanableSequence.hpp>
@@ -41,6 +43,7 @@
 #include <fastrtps/attributes/TopicAttributes.h>
 #include <fastrtps/qos/LivelinessChangedStatus.h>
 #include <fastrtps/types/TypesBase.h>
+#include <fastrtps/utils/TimedMutex.hpp>
 
 #include <fastdds/subscriber/DataReaderImpl/DataReaderLoanManager.hpp>
 #include <fastdds/subscriber/DataReaderImpl/SampleInfoPool.hpp>
@@ -191,8 +194,40 @@ public:
             void* data,
             SampleInfo* info);
 
+    ReturnCode_t read_serialized(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    ReturnCode_t take_serialized(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
     ///@}
 
+    /**
+     * Get the payload pool holding a payload loaned by @ref read_serialized or @ref take_serialized, so it can be
+     * shared by the changes of a DataWriter.
+     *
+     * @param payload        Payload loaned by this reader.
+     * @param owner          Upon success, pool set as owner of the buffer of @c payload.
+     * @param memory_policy  Upon success, memory policy of the returned pool.
+     *
+     * @return The pool holding the buffer of @c payload, or nullptr when @c payload is not a loan of this reader or
+     *         its buffer cannot be shared.
+     */
+    std::shared_ptr<ITopicPayloadPool> get_shareable_payload_pool(
+            const fastrtps::rtps::SerializedPayload_t& payload,
+            IPayloadPool*& owner,
+            fastrtps::rtps::MemoryManagementPolicy_t& memory_policy);
+
     ReturnCode_t return_loan(
             LoanableCollection& data_values,
             SampleInfoSeq& sample_infos);
@@ -380,6 +415,9 @@ public:
 
 protected:
 
+    //! Changes taken into an owned collection and pending deserialization, along with their slot on the collection
+    using DeferredChanges = std::vector<std::pair<LoanableCollection::size_type, fastrtps::rtps::CacheChange_t*>>;
+
     //!Subscriber
     SubscriberImpl* subscriber_ = nullptr;
 
@@ -488,6 +526,16 @@ protected:
     detail::SampleInfoPool sample_info_pool_;
     detail::DataReaderLoanManager loan_manager_;
 
+    /**
+     * Whether samples taken into owned collections are deserialized after releasing the reader mutex.
+     * The history is not split into per-instance locks instead, as the RTPS reception path updates it while
+     * holding the RTPSReader mutex, so every instance would still be serialized on that mutex.
+     */
+    bool deserialize_outside_lock_ = false;
+
+    //! Collections of deferred changes reused between calls. Protected by the reader mutex.
+    std::vector<DeferredChanges> deferred_changes_pool_;
+
     /**
      * Mutex to protect ReadCondition collection
      * is required because the RTPSReader mutex is only available when the object is enabled
@@ -554,13 +602,30 @@ protected:
             InstanceStateMask instance_states,
             bool exact_instance,
             bool single_instance,
-            bool should_take);
+            bool should_take,
+            bool serialized = false);
 
     ReturnCode_t read_or_take_next_sample(
             void* data,
             SampleInfo* info,
             bool should_take);
 
+    /**
+     * Deserialize the samples whose deserialization was deferred by a take operation.
+     * The reader mutex is released while deserializing, and the changes are returned to the reader's pool
+     * afterwards.
+     *
+     * @param lock         Lock held on the reader mutex. It is locked again on return.
+     * @param data_values  Collection where the samples should be deserialized.
+     * @param sample_infos Collection with the information of the samples.
+     * @param deferred     Changes pending deserialization. Cleared on return.
+     */
+    void deserialize_deferred_changes(
+            std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            DeferredChanges& deferred);
+
     void set_read_communication_status(
             bool trigger_value);
 
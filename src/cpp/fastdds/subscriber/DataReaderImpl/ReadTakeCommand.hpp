@@ -53,10 +53,12 @@ struct ReadTakeCommand
     using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
     using history_type = eprosima::fastdds::dds::detail::DataReaderHistory;
     using CacheChange_t = eprosima::fastrtps::rtps::CacheChange_t;
+    using SerializedPayload_t = eprosima::fastrtps::rtps::SerializedPayload_t;
     using RTPSReader = eprosima::fastrtps::rtps::RTPSReader;
     using WriterProxy = eprosima::fastrtps::rtps::WriterProxy;
     using SampleInfoSeq = LoanableTypedCollection<SampleInfo>;
     using DataSharingPayloadPool = eprosima::fastrtps::rtps::DataSharingPayloadPool;
+    using DeferredChanges = DataReaderImpl::DeferredChanges;
 
     ReadTakeCommand(
             DataReaderImpl& reader,
@@ -98,6 +100,30 @@ struct ReadTakeCommand
         }
     }
 
+    /**
+     * Request the deserialization of taken samples to be deferred.
+     * Samples taken into an owned collection will not be deserialized by this command. Their changes will be
+     * removed from the history without returning them to the reader's pool, and will be added to @c deferred
+     * together with the slot of the collection where they should be deserialized.
+     *
+     * @param deferred Collection where the changes pending deserialization will be added.
+     */
+    void defer_deserialization(
+            DeferredChanges& deferred)
+    {
+        deferred_ = &deferred;
+    }
+
+    /**
+     * Request the samples to be returned as SerializedPayload_t, without deserializing them.
+     * Loaned samples will reference the payload of the changes, which is kept in the reader's payload pool until
+     * the loan is returned. Samples on owned collections receive a copy of the payload.
+     */
+    void serialized_payloads()
+    {
+        serialized_ = true;
+    }
+
     bool add_instance(
             bool take_samples)
     {
@@ -146,7 +172,8 @@ struct ReadTakeCommand
                 {
                     // Add sample and info to collections
                     ReturnCode_t previous_return_value = return_value_;
-                    bool added = add_sample(*it, remove_change);
+                    bool deferred = take_samples && can_defer_deserialization(change);
+                    bool added = add_sample(*it, remove_change, deferred);
                     history_.change_was_processed_nts(change, added);
                     reader_->end_sample_access_nts(change, wp, added);
 
@@ -168,8 +195,8 @@ struct ReadTakeCommand
 
                     if (remove_change || (added && take_samples))
                     {
-                        // Remove from history
-                        history_.remove_change_sub(change, it);
+                        // Remove from history. Changes pending deserialization are released by the caller.
+                        history_.remove_change_sub(change, it, !(added && deferred));
 
                         // Current iterator will point to change next to the one removed. Avoid incrementing.
                         continue;
@@ -273,6 +300,9 @@ private:
     bool single_instance_;
     bool loop_for_data_;
 
+    DeferredChanges* deferred_ = nullptr;
+    bool serialized_ = false;
+
     bool finished_ = false;
     ReturnCode_t return_value_ = ReturnCode_t::RETCODE_NO_DATA;
 
@@ -316,12 +346,23 @@ private:
         return true;
     }
 
+    bool can_defer_deserialization(
+            CacheChange_t* change) const
+    {
+        // Datasharing payloads may be overridden by the writer once the reader mutex is released.
+        return (nullptr != deferred_) && data_values_.has_ownership() &&
+               (nullptr == dynamic_cast<DataSharingPayloadPool*>(change->payload_owner()));
+    }
+
     bool add_sample(
             const DataReaderCacheChange& item,
-            bool& deserialization_error)
+            bool& deserialization_error,
+            bool& deserialization_deferred)
     {
         bool ret_val = false;
         deserialization_error = false;
+        bool defer = deserialization_deferred;
+        deserialization_deferred = false;
 
         if (remaining_samples_ > 0)
         {
@@ -334,7 +375,12 @@ private:
             generate_info(item);
             if (sample_infos_[current_slot_].valid_data)
             {
-                if (!deserialize_sample(item))
+                if (defer)
+                {
+                    deferred_->emplace_back(current_slot_, item);
+                    deserialization_deferred = true;
+                }
+                else if (!deserialize_sample(item))
                 {
                     // Decrement length of collections
                     data_values_.length(current_slot_);
@@ -362,6 +408,13 @@ private:
         auto payload = &(change->serializedPayload);
         if (data_values_.has_ownership())
         {
+            if (serialized_)
+            {
+                // copy the serialized payload
+                auto dst = static_cast<SerializedPayload_t*>(data_values_.buffer()[current_slot_]);
+                return dst->copy(payload, false);
+            }
+
             // perform deserialization
             return type_->deserialize(payload, data_values_.buffer()[current_slot_]);
         }
@@ -369,7 +422,14 @@ private:
         {
             // loan
             void* sample;
-            sample_pool_->get_loan(change, sample);
+            if (serialized_)
+            {
+                sample_pool_->get_serialized_loan(change, sample);
+            }
+            else
+            {
+                sample_pool_->get_loan(change, sample);
+            }
             const_cast<void**>(data_values_.buffer())[current_slot_] = sample;
             return true;
         }
@@ -72,12 +72,17 @@ struct SampleLoanManager
 
     ~SampleLoanManager()
     {
-        if (!type_->is_plain())
+        for (OutstandingLoanItem& item : free_loans_)
         {
-            for (const OutstandingLoanItem& item : free_loans_)
+            if (!type_->is_plain())
             {
                 type_->deleteData(item.sample);
             }
+            if (nullptr != item.view)
+            {
+                item.view->data = nullptr;
+                delete item.view;
+            }
         }
     }
 
@@ -92,7 +97,7 @@ struct SampleLoanManager
             void*& sample)
     {
         // Early return an already loaned item
-        OutstandingLoanItem* item = find_by_change(change);
+        OutstandingLoanItem* item = find_by_change(change, false);
         if (nullptr != item)
         {
             item->num_refs += 1;
@@ -100,43 +105,7 @@ struct SampleLoanManager
             return;
         }
 
-        // Get an item from the pool
-        if (free_loans_.empty())
-        {
-            // Try to create a new entry
-            item = used_loans_.push_back({});
-            if (nullptr != item)
-            {
-                // Create sample if necessary
-                if (!type_->is_plain())
-                {
-                    item->sample = type_->createData();
-                }
-            }
-        }
-        else
-        {
-            // Reuse a free entry
-            item = used_loans_.push_back(free_loans_.back());
-            assert(nullptr != item);
-            free_loans_.pop_back();
-        }
-
-        // Should always find an entry, as resource limits are checked before calling this method
-        assert(nullptr != item);
-
-        // Should be the first time we loan this item
-        assert(item->num_refs == 0);
-
-        // Increment references of input payload
-        CacheChange_t tmp;
-        tmp.copy_not_memcpy(change);
-        item->owner = change->payload_owner();
-        change->payload_owner()->get_payload(change->serializedPayload, item->owner, tmp);
-        item->owner = tmp.payload_owner();
-        item->payload = tmp.serializedPayload;
-        tmp.payload_owner(nullptr);
-        tmp.serializedPayload.data = nullptr;
+        item = acquire_item(change);
 
         // Perform deserialization
         if (type_->is_plain())
@@ -155,6 +124,64 @@ struct SampleLoanManager
         sample = item->sample;
     }
 
+    /**
+     * Loan the serialized payload of a change, without deserializing it.
+     * The returned SerializedPayload_t references the buffer of the payload pool, which is kept alive until the
+     * loan is returned with @ref return_loan.
+     *
+     * @param change  Change whose payload is loaned.
+     * @param sample  Upon return, pointer to a read-only SerializedPayload_t.
+     */
+    void get_serialized_loan(
+            CacheChange_t* change,
+            void*& sample)
+    {
+        // Early return an already loaned item
+        OutstandingLoanItem* item = find_by_change(change, true);
+        if (nullptr != item)
+        {
+            item->num_refs += 1;
+            sample = item->view;
+            return;
+        }
+
+        item = acquire_item(change);
+
+        if (nullptr == item->view)
+        {
+            item->view = new SerializedPayload_t();
+        }
+        item->view->encapsulation = item->payload.encapsulation;
+        item->view->length = item->payload.length;
+        item->view->max_size = item->payload.max_size;
+        item->view->pos = 0;
+        item->view->data = item->payload.data;
+        item->is_serialized = true;
+
+        item->num_refs += 1;
+        sample = item->view;
+    }
+
+    /**
+     * Get the pool owning the payload of a serialized loan.
+     *
+     * @param sample  Pointer returned by @ref get_serialized_loan.
+     *
+     * @return The owner of the loaned payload, or nullptr if @c sample is not a serialized loan.
+     */
+    IPayloadPool* serialized_loan_owner(
+            const void* sample)
+    {
+        for (const OutstandingLoanItem& item : used_loans_)
+        {
+            if (item.is_serialized && sample == item.view)
+            {
+                return item.owner;
+            }
+        }
+        return nullptr;
+    }
+
     void return_loan(
             void* sample)
     {
@@ -170,6 +197,12 @@ struct SampleLoanManager
             item->owner->release_payload(tmp);
             item->payload.data = nullptr;
             item->owner = nullptr;
+            item->identity = SampleIdentity::unknown();
+            if (item->is_serialized)
+            {
+                item->view->data = nullptr;
+                item->is_serialized = false;
+            }
 
             item = free_loans_.push_back(*item);
             assert(nullptr != item);
@@ -186,6 +219,9 @@ private:
         SerializedPayload_t payload;
         IPayloadPool* owner = nullptr;
         uint32_t num_refs = 0;
+        //! Payload returned to the user on serialized loans. Its data belongs to the payload pool.
+        SerializedPayload_t* view = nullptr;
+        bool is_serialized = false;
 
         ~OutstandingLoanItem()
         {
@@ -217,16 +253,75 @@ private:
     collection_type used_loans_;
     TypeSupport type_;
 
-    OutstandingLoanItem* find_by_change(
+    OutstandingLoanItem* acquire_item(
             CacheChange_t* change)
+    {
+        OutstandingLoanItem* item = nullptr;
+
+        // Get an item from the pool
+        if (free_loans_.empty())
+        {
+            // Try to create a new entry
+            item = used_loans_.push_back({});
+            if (nullptr != item)
+            {
+                // Create sample if necessary
+                if (!type_->is_plain())
+                {
+                    item->sample = type_->createData();
+                }
+            }
+        }
+        else
+        {
+            // Reuse a free entry
+            item = used_loans_.push_back(free_loans_.back());
+            assert(nullptr != item);
+            free_loans_.pop_back();
+        }
+
+        // Should always find an entry, as resource limits are checked before calling this method
+        assert(nullptr != item);
+
+        // Should be the first time we loan this item
+        assert(item->num_refs == 0);
+
+        item->identity.writer_guid(change->writerGUID);
+        item->identity.sequence_number(change->sequenceNumber);
+
+        // Increment references of input payload
+        CacheChange_t tmp;
+        tmp.copy_not_memcpy(change);
+        item->owner = change->payload_owner();
+        change->payload_owner()->get_payload(change->serializedPayload, item->owner, tmp);
+        item->owner = tmp.payload_owner();
+        item->payload = tmp.serializedPayload;
+        tmp.payload_owner(nullptr);
+        tmp.serializedPayload.data = nullptr;
+
+        return item;
+    }
+
+    /**
+     * Find the item of an outstanding loan of a change.
+     * Typed and serialized loans of the same change are kept on different items, as they return different objects.
+     *
+     * @param change         Change to look for.
+     * @param is_serialized  Whether to look for a serialized loan or for a typed one.
+     *
+     * @return The item of the loan, or nullptr if the change is not loaned with the requested kind.
+     */
+    OutstandingLoanItem* find_by_change(
+            CacheChange_t* change,
+            bool is_serialized)
     {
         SampleIdentity id;
         id.writer_guid(change->writerGUID);
         id.sequence_number(change->sequenceNumber);
 
-        auto comp = [id](const OutstandingLoanItem& item)
+        auto comp = [id, is_serialized](const OutstandingLoanItem& item)
                 {
-                    return id == item.identity;
+                    return is_serialized == item.is_serialized && id == item.identity;
                 };
         auto it = std::find_if(used_loans_.begin(), used_loans_.end(), comp);
         if (it != used_loans_.end())
@@ -241,7 +336,7 @@ private:
     {
         auto comp = [sample](const OutstandingLoanItem& item)
                 {
-                    return sample == item.sample;
+                    return sample == (item.is_serialized ? static_cast<void*>(item.view) : item.sample);
                 };
         auto it = std::find_if(used_loans_.begin(), used_loans_.end(), comp);
         assert(it != used_loans_.end());
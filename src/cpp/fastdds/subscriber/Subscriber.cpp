@@ -60,6 +60,16 @@ ReturnCode_t Subscriber::enable()
     return ret_code;
 }
 
+ReturnCode_t Subscriber::enable_datareaders()
+{
+    if (!enable_)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    return impl_->enable_datareaders();
+}
+
 const SubscriberQos& Subscriber::get_qos() const
 {
     return impl_->get_qos();
@@ -29,6 +29,7 @@
 #include <fastdds/dds/subscriber/SubscriberListener.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/utils/ParallelEnabler.hpp>
 #include <fastdds/utils/QosConverters.hpp>
 
 #include <fastdds/rtps/common/Property.h>
@@ -84,6 +85,27 @@ ReturnCode_t SubscriberImpl::enable()
     return ReturnCode_t::RETCODE_OK;
 }
 
+ReturnCode_t SubscriberImpl::enable_datareaders()
+{
+    std::vector<DataReader*> disabled_readers;
+    {
+        std::lock_guard<std::mutex> lock(mtx_readers_);
+        for (auto& topic_readers : readers_)
+        {
+            for (DataReaderImpl* dr : topic_readers.second)
+            {
+                if (!dr->user_datareader_->is_enabled())
+                {
+                    disabled_readers.push_back(dr->user_datareader_);
+                }
+            }
+        }
+    }
+
+    // The lock is not kept, as enabling an endpoint may call back the user listeners
+    return utils::enable_in_parallel(disabled_readers);
+}
+
 void SubscriberImpl::disable()
 {
     set_listener(nullptr);
@@ -83,6 +83,8 @@ public:
 
     ReturnCode_t enable();
 
+    ReturnCode_t enable_datareaders();
+
     const SubscriberQos& get_qos() const;
 
     ReturnCode_t set_qos(
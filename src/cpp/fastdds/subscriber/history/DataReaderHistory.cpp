@@ -461,7 +461,8 @@ bool DataReaderHistory::remove_change_sub(
 
 bool DataReaderHistory::remove_change_sub(
         CacheChange_t* change,
-        DataReaderInstance::ChangeCollection::iterator& it)
+        DataReaderInstance::ChangeCollection::iterator& it,
+        bool release)
 {
     if (mp_reader == nullptr || mp_mutex == nullptr)
     {
@@ -504,7 +505,7 @@ bool DataReaderHistory::remove_change_sub(
     }
 
     m_isHistoryFull = false;
-    ReaderHistory::remove_change_nts(chit);
+    ReaderHistory::remove_change_nts(chit, release);
 
     counters_.samples_unread = mp_reader->get_unread_count();
     return true;
@@ -202,14 +202,17 @@ public:
     /**
      * This method is called to remove a change from the DataReaderHistory.
      *
-     * @param [in]     change Pointer to the CacheChange_t.
-     * @param [in,out] it     Iterator pointing to change on input. Will point to next valid change on output.
+     * @param [in]     change  Pointer to the CacheChange_t.
+     * @param [in,out] it      Iterator pointing to change on input. Will point to next valid change on output.
+     * @param [in]     release Whether the change should be returned to the reader's pool.
+     *                         When false, the caller is responsible for calling RTPSReader::releaseCache.
      *
      * @return True if removed.
      */
     bool remove_change_sub(
             CacheChange_t* change,
-            DataReaderInstance::ChangeCollection::iterator& it);
+            DataReaderInstance::ChangeCollection::iterator& it,
+            bool release = true);
 
     /**
      * Called when a writer is unmatched from the reader holding this history.
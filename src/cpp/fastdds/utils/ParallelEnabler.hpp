@@ -0,0 +1,95 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParallelEnabler.hpp
+ */
+
+#ifndef _FASTDDS_UTILS_PARALLEL_ENABLER_HPP_
+#define _FASTDDS_UTILS_PARALLEL_ENABLER_HPP_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <fastrtps/types/TypesBase.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace utils {
+
+/**
+ * Call enable() on every entity of a collection, using several threads.
+ *
+ * Most of the work of enabling an endpoint (payload pools allocation, RTPS endpoint creation, matching) is
+ * independent from the other endpoints, so it is spread among as many threads as hardware threads are available.
+ * The calling thread also takes part, and the function returns when all the entities have been processed.
+ *
+ * @param entities  Entities to enable. They should not be deleted until this function returns.
+ *
+ * @return RETCODE_OK if every entity was enabled, the error of the first one that failed otherwise.
+ */
+template<typename EntityT>
+fastrtps::types::ReturnCode_t enable_in_parallel(
+        const std::vector<EntityT*>& entities)
+{
+    using fastrtps::types::ReturnCode_t;
+
+    std::atomic<size_t> next_entity{0};
+    std::atomic<uint32_t> result{ReturnCode_t::RETCODE_OK};
+
+    auto enable_entities = [&entities, &next_entity, &result]()
+            {
+                size_t index = next_entity.fetch_add(1);
+                while (index < entities.size())
+                {
+                    ReturnCode_t ret_code = entities[index]->enable();
+                    if (ReturnCode_t::RETCODE_OK != ret_code)
+                    {
+                        uint32_t expected = ReturnCode_t::RETCODE_OK;
+                        result.compare_exchange_strong(expected, ret_code());
+                    }
+                    index = next_entity.fetch_add(1);
+                }
+            };
+
+    size_t num_threads = std::max<size_t>(1u, std::thread::hardware_concurrency());
+    num_threads = std::min(num_threads, entities.size());
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; ++i)
+    {
+        threads.emplace_back(enable_entities);
+    }
+    enable_entities();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    return ReturnCode_t(result.load());
+}
+
+} /* namespace utils */
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif // ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif /* _FASTDDS_UTILS_PARALLEL_ENABLER_HPP_ */
@@ -154,8 +154,13 @@ void set_qos_from_attributes(
     qos.transport().use_builtin_transports = attr.useBuiltinTransports;
     qos.transport().send_socket_buffer_size = attr.sendSocketBufferSize;
     qos.transport().listen_socket_buffer_size = attr.listenSocketBufferSize;
+    qos.transport().builtin_transports_reception_threads = attr.builtin_transports_reception_threads;
     qos.name() = attr.getName();
     qos.flow_controllers() = attr.flow_controllers;
+    qos.timed_events_thread(attr.timed_events_thread);
+    qos.discovery_server_thread(attr.discovery_server_thread);
+    qos.builtin_controllers_sender_thread(attr.builtin_controllers_sender_thread);
+    qos.data_sharing_listener_thread(attr.data_sharing_listener_thread);
 
     // Merge attributes and qos properties
     for (auto property : attr.properties.properties())
@@ -194,8 +199,13 @@ void set_attributes_from_qos(
     attr.useBuiltinTransports = qos.transport().use_builtin_transports;
     attr.sendSocketBufferSize = qos.transport().send_socket_buffer_size;
     attr.listenSocketBufferSize = qos.transport().listen_socket_buffer_size;
+    attr.builtin_transports_reception_threads = qos.transport().builtin_transports_reception_threads;
     attr.userData = qos.user_data().data_vec();
     attr.flow_controllers = qos.flow_controllers();
+    attr.timed_events_thread = qos.timed_events_thread();
+    attr.discovery_server_thread = qos.discovery_server_thread();
+    attr.builtin_controllers_sender_thread = qos.builtin_controllers_sender_thread();
+    attr.data_sharing_listener_thread = qos.data_sharing_listener_thread();
 }
 
 void set_qos_from_attributes(
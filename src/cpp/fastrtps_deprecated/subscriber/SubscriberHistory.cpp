@@ -602,8 +602,7 @@ bool SubscriberHistory::remove_change_sub(
             {
                 if ((*chit)->sequenceNumber == change->sequenceNumber && (*chit)->writerGUID == change->writerGUID)
                 {
-                    assert(it == chit);
-                    it = vit->second.cache_changes.erase(chit);
+                    vit->second.cache_changes.erase(chit);
                     found = true;
                     break;
                 }
@@ -622,13 +621,9 @@ bool SubscriberHistory::remove_change_sub(
         return false;
     }
 
+    assert(it == chit);
     m_isHistoryFull = false;
-    iterator ret_it = remove_change_nts(chit);
-
-    if (topic_att_.getTopicKind() != WITH_KEY)
-    {
-        it = ret_it;
-    }
+    it = remove_change_nts(chit);
 
     return true;
 }
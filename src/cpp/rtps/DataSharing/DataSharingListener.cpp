@@ -18,6 +18,7 @@
 
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <fastdds/rtps/reader/RTPSReader.h>
+#include <utils/threading.hpp>
 
 #include <memory>
 #include <mutex>
@@ -31,6 +32,7 @@ DataSharingListener::DataSharingListener(
         std::shared_ptr<DataSharingNotification> notification,
         const std::string& datasharing_pools_directory,
         ResourceLimitedContainerConfig limits,
+        const fastdds::rtps::ThreadSettings& thread_settings,
         RTPSReader* reader)
     : notification_(notification)
     , is_running_(false)
@@ -38,6 +40,7 @@ DataSharingListener::DataSharingListener(
     , writer_pools_(limits)
     , writer_pools_changed_(false)
     , datasharing_pools_directory_(datasharing_pools_directory)
+    , thread_settings_(thread_settings)
 {
 }
 
@@ -49,6 +52,8 @@ DataSharingListener::~DataSharingListener()
 
 void DataSharingListener::run()
 {
+    configure_current_thread(thread_settings_, "dds.dsha", 0);
+
     std::unique_lock<Segment::mutex> lock(notification_->notification_->notification_mutex, std::defer_lock);
     while (is_running_.load())
     {
@@ -20,6 +20,7 @@
 #define RTPS_DATASHARING_DATASHARINGLISTENER_HPP
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <rtps/DataSharing/IDataSharingListener.hpp>
 #include <rtps/DataSharing/DataSharingNotification.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
@@ -47,6 +48,7 @@ public:
             std::shared_ptr<DataSharingNotification> notification,
             const std::string& datasharing_pools_directory,
             ResourceLimitedContainerConfig limits,
+            const fastdds::rtps::ThreadSettings& thread_settings,
             RTPSReader* reader);
 
     virtual ~DataSharingListener();
@@ -115,6 +117,7 @@ protected:
     ResourceLimitedVector<WriterInfo> writer_pools_;
     std::atomic<bool> writer_pools_changed_;
     std::string datasharing_pools_directory_;
+    fastdds::rtps::ThreadSettings thread_settings_;
     mutable std::mutex mutex_;
 
 };
@@ -20,6 +20,7 @@
 #include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
 
 #include <chrono>
+#include <cstring>
 #include <mutex>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -683,6 +684,7 @@ void ParticipantProxyData::clear()
     m_properties.length = 0;
     m_userData.clear();
     m_userData.length = 0;
+    last_announcement_.clear();
 }
 
 void ParticipantProxyData::copy(
@@ -838,6 +840,20 @@ void ParticipantProxyData::assert_liveliness()
     last_received_message_tm_ = std::chrono::steady_clock::now();
 }
 
+bool ParticipantProxyData::is_last_announcement(
+        const SerializedPayload_t& payload) const
+{
+    return !last_announcement_.empty() &&
+           payload.length == last_announcement_.size() &&
+           0 == std::memcmp(payload.data, last_announcement_.data(), payload.length);
+}
+
+void ParticipantProxyData::set_last_announcement(
+        const SerializedPayload_t& payload)
+{
+    last_announcement_.assign(payload.data, payload.data + payload.length);
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -29,6 +29,7 @@
 #include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
 
 #include <nlohmann/json.hpp>
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 
 namespace eprosima {
@@ -44,6 +45,7 @@ DiscoveryDataBase::DiscoveryDataBase(
     , servers_(servers)
     , enabled_(true)
     , new_updates_(0)
+    , participant_acks_generation_(0)
     , processing_backup_(false)
     , is_persistent_(false)
 {
@@ -58,7 +60,7 @@ DiscoveryDataBase::~DiscoveryDataBase()
 
     if (is_persistent_)
     {
-        backup_file_.close();
+        backup_journal_.close();
     }
 }
 
@@ -290,9 +292,11 @@ void DiscoveryDataBase::add_ack_(
         {
             // Only add ACK if the change in the database is the same as the incoming change. Else, the change in the
             // database has been updated, so this ACK is not relevant anymore
-            if (it->second.change()->write_params.sample_identity() == change->write_params.sample_identity())
+            if (it->second.change()->write_params.sample_identity() == change->write_params.sample_identity() &&
+                    !it->second.is_matched(acked_entity))
             {
                 it->second.add_or_update_ack_participant(acked_entity, true);
+                ++participant_acks_generation_;
             }
         }
     }
@@ -338,10 +342,12 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been processed
         std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        if (!backup_journal_.append(*change))
+        {
+            // The change is still stored on the next database dump, once it has been processed
+            EPROSIMA_LOG_WARNING(DISCOVERY_DATABASE,
+                    "Backup journal full, change not journaled: " << change->instanceHandle);
+        }
     }
 
     if (!enabled_)
@@ -370,10 +376,12 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been process
         std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        if (!backup_journal_.append(*change))
+        {
+            // The change is still stored on the next database dump, once it has been processed
+            EPROSIMA_LOG_WARNING(DISCOVERY_DATABASE,
+                    "Backup journal full, change not journaled: " << change->instanceHandle);
+        }
     }
 
     if (!enabled_)
@@ -678,7 +686,7 @@ void DiscoveryDataBase::create_new_participant_from_change_(
 {
     fastrtps::rtps::GUID_t change_guid = guid_from_change(ch);
 
-    std::pair<std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator, bool> ret =
+    std::pair<ParticipantMap::iterator, bool> ret =
             participants_.insert(
         std::make_pair(
             change_guid.guidPrefix,
@@ -863,7 +871,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
+        std::pair<EndpointMap::iterator, bool> ret =
                 writers_.insert(std::make_pair(writer_guid, tmp_writer));
         if (!ret.second)
         {
@@ -876,7 +884,7 @@ void DiscoveryDataBase::create_writers_from_change_(
         new_updates_++;
 
         // Add entry to participants_[guid_prefix]::writers
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+        ParticipantMap::iterator writer_part_it =
                 participants_.find(writer_guid.guidPrefix);
         if (writer_part_it != participants_.end())
         {
@@ -981,7 +989,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
+        std::pair<EndpointMap::iterator, bool> ret =
                 readers_.insert(std::make_pair(reader_guid, tmp_reader));
         if (!ret.second)
         {
@@ -994,7 +1002,7 @@ void DiscoveryDataBase::create_readers_from_change_(
         new_updates_++;
 
         // Add entry to participants_[guid_prefix]::readers
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+        ParticipantMap::iterator reader_part_it =
                 participants_.find(reader_guid.guidPrefix);
         if (reader_part_it != participants_.end())
         {
@@ -1233,7 +1241,7 @@ void DiscoveryDataBase::process_dispose_participant_(
     const eprosima::fastrtps::rtps::GUID_t& participant_guid = guid_from_change(ch);
 
     // Change DATA(p) with DATA(Up) in participants map
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator pit =
+    ParticipantMap::iterator pit =
             participants_.find(participant_guid.guidPrefix);
     if (pit != participants_.end())
     {
@@ -1303,7 +1311,7 @@ void DiscoveryDataBase::process_dispose_writer_(
     const eprosima::fastrtps::rtps::GUID_t& writer_guid = guid_from_change(ch);
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator wit = writers_.find(writer_guid);
+    EndpointMap::iterator wit = writers_.find(writer_guid);
     if (wit != writers_.end())
     {
         // Change DATA(w) with DATA(Uw)
@@ -1333,7 +1341,7 @@ void DiscoveryDataBase::process_dispose_reader_(
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator rit = readers_.find(reader_guid);
+    EndpointMap::iterator rit = readers_.find(reader_guid);
     if (rit != readers_.end())
     {
         // Change DATA(r) with DATA(Ur)
@@ -1369,10 +1377,10 @@ bool DiscoveryDataBase::process_dirty_topics()
     std::lock_guard<std::recursive_mutex> guard(mutex_);
 
     // Iterator objects are declared here because they are reused in each iteration of the loops
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_reader_it;
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_writer_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator readers_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator writers_it;
+    ParticipantMap::iterator parts_reader_it;
+    ParticipantMap::iterator parts_writer_it;
+    EndpointMap::iterator readers_it;
+    EndpointMap::iterator writers_it;
 
     // Iterate over dirty_topics_
     for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end();)
@@ -1382,14 +1390,14 @@ bool DiscoveryDataBase::process_dirty_topics()
         bool is_clearable = true;
 
         // Get all the writers in the topic
-        std::vector<fastrtps::rtps::GUID_t> writers;
+        EndpointSet writers;
         auto ret = writers_by_topic_.find(*topic_it);
         if (ret != writers_by_topic_.end())
         {
             writers = ret->second;
         }
         // Get all the readers in the topic
-        std::vector<fastrtps::rtps::GUID_t> readers;
+        EndpointSet readers;
         ret = readers_by_topic_.find(*topic_it);
         if (ret != readers_by_topic_.end())
         {
@@ -1969,44 +1977,22 @@ void DiscoveryDataBase::remove_writer_from_topic_(
 {
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it;
-        for (topic_it = writers_by_topic_.begin(); topic_it != writers_by_topic_.end(); topic_it++)
+        for (auto& topic : writers_by_topic_)
         {
-            for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator writer_it = topic_it->second.begin();
-                    writer_it != topic_it->second.end();
-                    ++writer_it)
-            {
-                if (*writer_it == writer_guid)
-                {
-                    topic_it->second.erase(writer_it);
-                    break;
-                }
-            }
+            topic.second.erase(writer_guid);
         }
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it =
-                writers_by_topic_.find(topic_name);
+        auto topic_it = writers_by_topic_.find(topic_name);
         if (topic_it != writers_by_topic_.end())
         {
-            for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator writer_it = topic_it->second.begin();
-                    writer_it != topic_it->second.end();
-                    ++writer_it)
-            {
-                if (*writer_it == writer_guid)
-                {
-                    topic_it->second.erase(writer_it);
-                    break;
-                }
-            }
+            topic_it->second.erase(writer_guid);
             // The topic wont be deleted to avoid creating and matching again all the virtual endpoints
             // This only affects a virtual endpoint, that will be added in this topic, but nothing will be matched
             // This also helps because topics are symetrical, and removing one implies check the other's emptyness first.
         }
     }
-
-
 }
 
 void DiscoveryDataBase::remove_reader_from_topic_(
@@ -2017,37 +2003,17 @@ void DiscoveryDataBase::remove_reader_from_topic_(
 
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it;
-        for (topic_it = readers_by_topic_.begin(); topic_it != readers_by_topic_.end(); topic_it++)
+        for (auto& topic : readers_by_topic_)
         {
-            for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator reader_it = topic_it->second.begin();
-                    reader_it != topic_it->second.end();
-                    ++reader_it)
-            {
-                if (*reader_it == reader_guid)
-                {
-                    topic_it->second.erase(reader_it);
-                    break;
-                }
-            }
+            topic.second.erase(reader_guid);
         }
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it =
-                readers_by_topic_.find(topic_name);
+        auto topic_it = readers_by_topic_.find(topic_name);
         if (topic_it != readers_by_topic_.end())
         {
-            for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator reader_it = topic_it->second.begin();
-                    reader_it != topic_it->second.end();
-                    ++reader_it)
-            {
-                if (*reader_it == reader_guid)
-                {
-                    topic_it->second.erase(reader_it);
-                    break;
-                }
-            }
+            topic_it->second.erase(reader_guid);
             // The topic wont be deleted to avoid creating and matching again all the virtual endpoints
             // this only affects a virtual endpoint, that will be added in this topic, but nothing will be matched
         }
@@ -2058,10 +2024,7 @@ void DiscoveryDataBase::create_topic_(
         const std::string& topic_name)
 {
     // Create writers topic
-    auto wit = writers_by_topic_.insert(
-        std::pair<std::string, std::vector<fastrtps::rtps::GUID_t>>(
-            topic_name,
-            std::vector<fastrtps::rtps::GUID_t>()));
+    auto wit = writers_by_topic_.insert(std::make_pair(topic_name, EndpointSet()));
     if (wit.second)
     {
         // Find virtual topic
@@ -2070,18 +2033,12 @@ void DiscoveryDataBase::create_topic_(
         {
             // add all virtual writers
             // in case virtual topic does not exist do nothing
-            for (fastrtps::rtps::GUID_t virtual_writer : v_wit->second)
-            {
-                wit.first->second.push_back(virtual_writer);
-            }
+            wit.first->second.insert(v_wit->second.begin(), v_wit->second.end());
         }
     } // Else topic already existed
 
     // Create readers topic
-    auto rit = readers_by_topic_.insert(
-        std::pair<std::string, std::vector<fastrtps::rtps::GUID_t>>(
-            topic_name,
-            std::vector<fastrtps::rtps::GUID_t>()));
+    auto rit = readers_by_topic_.insert(std::make_pair(topic_name, EndpointSet()));
     if (rit.second)
     {
         // Find virtual topic
@@ -2090,10 +2047,7 @@ void DiscoveryDataBase::create_topic_(
         {
             // add all virtual readers
             // in case virtual topic does not exist do nothing
-            for (fastrtps::rtps::GUID_t virtual_reader : v_rit->second)
-            {
-                rit.first->second.push_back(virtual_reader);
-            }
+            rit.first->second.insert(v_rit->second.begin(), v_rit->second.end());
         }
     } // Else topic already existed
 
@@ -2120,15 +2074,12 @@ void DiscoveryDataBase::add_writer_to_topic_(
                 it_topics != writers_by_topic_.end();
                 ++it_topics)
         {
-            // This find should be useless because right now we only call this function from
+            // The insertion should always succeed because right now we only call this function from
             // create_writer_from_change, so the entity must be always new
-            std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator writer_by_topic_it =
-                    std::find(it_topics->second.begin(), it_topics->second.end(), writer_guid);
-            if (writer_by_topic_it == it_topics->second.end())
+            if (it_topics->second.insert(writer_guid).second)
             {
                 EPROSIMA_LOG_INFO(DISCOVERY_DATABASE,
                         "New virtual writer " << writer_guid << " in writers_by_topic: " << it_topics->first);
-                it_topics->second.push_back(writer_guid);
             }
         }
         // The writer has been already added to every topic, avoid try to add it again in virtual topic
@@ -2136,12 +2087,9 @@ void DiscoveryDataBase::add_writer_to_topic_(
     }
 
     // Add the writer in the topic
-    std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator writer_by_topic_it =
-            std::find(it->second.begin(), it->second.end(), writer_guid);
-    if (writer_by_topic_it == it->second.end())
+    if (it->second.insert(writer_guid).second)
     {
         EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "New writer " << writer_guid << " in writers_by_topic: " << topic_name);
-        it->second.push_back(writer_guid);
     }
 }
 
@@ -2165,15 +2113,12 @@ void DiscoveryDataBase::add_reader_to_topic_(
                 it_topics != readers_by_topic_.end();
                 ++it_topics)
         {
-            // This find should be useless because right now we only call this function from
+            // The insertion should always succeed because right now we only call this function from
             // create_reader_from_change, so the entity must be always new
-            std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator reader_by_topic_it =
-                    std::find(it_topics->second.begin(), it_topics->second.end(), reader_guid);
-            if (reader_by_topic_it == it_topics->second.end())
+            if (it_topics->second.insert(reader_guid).second)
             {
                 EPROSIMA_LOG_INFO(DISCOVERY_DATABASE,
                         "New virtual reader " << reader_guid << " in readers_by_topic: " << it_topics->first);
-                it_topics->second.push_back(reader_guid);
             }
         }
         // The reader has been already added to every topic, avoid try to add it again in virtual topic
@@ -2181,12 +2126,9 @@ void DiscoveryDataBase::add_reader_to_topic_(
     }
 
     // Add the reader in the topic
-    std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator reader_by_topic_it =
-            std::find(it->second.begin(), it->second.end(), reader_guid);
-    if (reader_by_topic_it == it->second.end())
+    if (it->second.insert(reader_guid).second)
     {
         EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "New reader " << reader_guid << " in readers_by_topic: " << topic_name);
-        it->second.push_back(reader_guid);
     }
 }
 
@@ -2203,9 +2145,8 @@ bool DiscoveryDataBase::delete_participant_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator
-DiscoveryDataBase::delete_participant_entity_(
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it)
+DiscoveryDataBase::ParticipantMap::iterator DiscoveryDataBase::delete_participant_entity_(
+        ParticipantMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting participant: " << it->first);
     if (it == participants_.end())
@@ -2230,8 +2171,8 @@ bool DiscoveryDataBase::delete_reader_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_reader_entity_(
-        std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_reader_entity_(
+        EndpointMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting reader: " << it->first.guidPrefix);
     if (it == readers_.end())
@@ -2279,8 +2220,8 @@ bool DiscoveryDataBase::delete_writer_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_writer_entity_(
-        std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_writer_entity_(
+        EndpointMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting writer: " << it->first.guidPrefix);
     if (it == writers_.end())
@@ -2514,7 +2455,7 @@ bool DiscoveryDataBase::from_json(
             add_writer_to_topic_(guid_aux, topic);
 
             // Add writer to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+            ParticipantMap::iterator writer_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (writer_part_it != participants_.end())
             {
@@ -2572,7 +2513,7 @@ bool DiscoveryDataBase::from_json(
             add_reader_to_topic_(guid_aux, topic);
 
             // Add reader to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+            ParticipantMap::iterator reader_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (reader_part_it != participants_.end())
             {
@@ -2611,17 +2552,14 @@ void DiscoveryDataBase::clean_backup()
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
 
     // This will erase the last backup stored
-    backup_file_.close();
-    backup_file_.open(backup_file_name_, std::ios_base::out);
+    backup_journal_.truncate();
 }
 
 void DiscoveryDataBase::persistence_enable(
         std::string backup_file_name)
 {
     is_persistent_ = true;
-    backup_file_name_ = backup_file_name;
-    // It opens the file in append mode because the info in it has not been yet
-    backup_file_.open(backup_file_name_, std::ios::app);
+    backup_journal_.open(backup_file_name);
 }
 
 bool DiscoveryDataBase::is_participant_local(
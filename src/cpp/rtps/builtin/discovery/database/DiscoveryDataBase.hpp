@@ -25,6 +25,8 @@
 #include <map>
 #include <mutex>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <fastrtps/utils/fixed_size_string.hpp>
@@ -37,6 +39,7 @@
 #include <rtps/builtin/discovery/database/DiscoveryParticipantInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryEndpointInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryDataQueueInfo.hpp>
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
 
 #include <nlohmann/json.hpp>
 
@@ -334,6 +337,13 @@ public:
         return virtual_topic_;
     }
 
+    // Return the number of times a participant has acknowledged the current DATA(p) of another one.
+    // The relevance of the EDP changes depends on those acknowledgements.
+    uint64_t participant_acks_generation() const
+    {
+        return participant_acks_generation_.load();
+    }
+
     // Return number of updated entities since last call to this same function
     int updates_since_last_checked()
     {
@@ -355,6 +365,11 @@ public:
 
 protected:
 
+    using ParticipantMap = std::unordered_map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>;
+    using EndpointMap = std::unordered_map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>;
+    using EndpointSet = std::unordered_set<eprosima::fastrtps::rtps::GUID_t>;
+    using EndpointsByTopicMap = std::unordered_map<std::string, EndpointSet>;
+
     // change a cacheChange by update or new disposal
     void update_change_and_unmatch_(
             fastrtps::rtps::CacheChange_t* new_change,
@@ -446,22 +461,22 @@ protected:
     bool delete_participant_entity_(
             const fastrtps::rtps::GuidPrefix_t& guid_prefix);
 
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator delete_participant_entity_(
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it);
+    ParticipantMap::iterator delete_participant_entity_(
+            ParticipantMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_writer_entity_(
             const fastrtps::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_writer_entity_(
-            std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_writer_entity_(
+            EndpointMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_reader_entity_(
             const fastrtps::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_reader_entity_(
-            std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_reader_entity_(
+            EndpointMap::iterator it);
 
     // return if there are more than one writer in the participant in the same topic
     bool repeated_writer_topic_(
@@ -526,21 +541,21 @@ protected:
     fastrtps::DBQueue<eprosima::fastdds::rtps::ddb::DiscoveryEDPDataQueueInfo> edp_data_queue_;
 
     //! Covenient per-topic mapping of readers and writers to speed-up queries
-    std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>> readers_by_topic_;
-    std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>> writers_by_topic_;
+    EndpointsByTopicMap readers_by_topic_;
+    EndpointsByTopicMap writers_by_topic_;
 
     //! Collection of participant proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - keeps an account of participant's readers and writers
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo> participants_;
+    ParticipantMap participants_;
 
     //! Collection of reader and writer proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - stores the topic name (only matching criteria available)
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> readers_;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> writers_;
+    EndpointMap readers_;
+    EndpointMap writers_;
 
     //! Collection of topics whose related endpoints have changed and require a match recalculation
     std::vector<std::string> dirty_topics_;
@@ -580,17 +595,19 @@ protected:
     // Whether it has been a new entity discovered or updated in this subroutine loop
     std::atomic<int> new_updates_;
 
+    // Increased each time a DATA(p) is acknowledged by a participant that had not acknowledged it yet
+    std::atomic<uint64_t> participant_acks_generation_;
+
     // Whether the database is restoring a backup
     std::atomic<bool> processing_backup_;
 
     // Whether the database is persistent, so it must store every cache it arrives
     bool is_persistent_;
 
-    // File to save every cacheChange that is updated to the ddb queues
-    std::string backup_file_name_;
-    // This file will keep open to write it fast every time a new cache arrives
-    // It needs a flush every time a new change is added
-    std::ofstream backup_file_;
+    // Journal to save every cacheChange that is updated to the ddb queues
+    // Changes are copied in binary form and written to disk by its own thread, so storing them does not block
+    // the reception of new data
+    BackupJournal backup_journal_;
 };
 
 
@@ -0,0 +1,589 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BackupJournal.cpp
+ *
+ */
+
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/EntityId_t.hpp>
+#include <statistics/rtps/GuidUtils.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+namespace {
+
+using fastrtps::rtps::octet;
+
+// Integers are stored in little endian, regardless of the host byte order
+void put_le(
+        std::vector<uint8_t>& buffer,
+        uint64_t value,
+        size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void put(
+        std::vector<uint8_t>& buffer,
+        uint8_t value)
+{
+    buffer.push_back(value);
+}
+
+void put(
+        std::vector<uint8_t>& buffer,
+        uint16_t value)
+{
+    put_le(buffer, value, sizeof(value));
+}
+
+void put(
+        std::vector<uint8_t>& buffer,
+        uint32_t value)
+{
+    put_le(buffer, value, sizeof(value));
+}
+
+void put(
+        std::vector<uint8_t>& buffer,
+        int32_t value)
+{
+    put_le(buffer, static_cast<uint32_t>(value), sizeof(value));
+}
+
+void put(
+        std::vector<uint8_t>& buffer,
+        const fastrtps::rtps::GUID_t& guid)
+{
+    buffer.insert(buffer.end(), guid.guidPrefix.value, guid.guidPrefix.value + fastrtps::rtps::GuidPrefix_t::size);
+    buffer.insert(buffer.end(), guid.entityId.value, guid.entityId.value + fastrtps::rtps::EntityId_t::size);
+}
+
+void put(
+        std::vector<uint8_t>& buffer,
+        const fastrtps::rtps::SequenceNumber_t& sn)
+{
+    put(buffer, sn.high);
+    put(buffer, sn.low);
+}
+
+void put(
+        std::vector<uint8_t>& buffer,
+        const fastrtps::rtps::Time_t& time)
+{
+    put(buffer, time.seconds());
+    put(buffer, time.fraction());
+}
+
+void put(
+        std::vector<uint8_t>& buffer,
+        const fastrtps::rtps::SampleIdentity& identity)
+{
+    put(buffer, identity.writer_guid());
+    put(buffer, identity.sequence_number());
+}
+
+//! Bounds checked reader of a journal record
+class RecordReader
+{
+public:
+
+    RecordReader(
+            const uint8_t* data,
+            size_t size)
+        : data_(data)
+        , size_(size)
+    {
+    }
+
+    bool get_le(
+            uint64_t& value,
+            size_t size)
+    {
+        if (size_ - offset_ < size)
+        {
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < size; ++i)
+        {
+            value |= static_cast<uint64_t>(data_[offset_ + i]) << (8 * i);
+        }
+        offset_ += size;
+        return true;
+    }
+
+    bool get(
+            uint8_t& value)
+    {
+        uint64_t v = 0;
+        bool ret = get_le(v, sizeof(value));
+        value = static_cast<uint8_t>(v);
+        return ret;
+    }
+
+    bool get(
+            uint16_t& value)
+    {
+        uint64_t v = 0;
+        bool ret = get_le(v, sizeof(value));
+        value = static_cast<uint16_t>(v);
+        return ret;
+    }
+
+    bool get(
+            uint32_t& value)
+    {
+        uint64_t v = 0;
+        bool ret = get_le(v, sizeof(value));
+        value = static_cast<uint32_t>(v);
+        return ret;
+    }
+
+    bool get(
+            int32_t& value)
+    {
+        uint32_t v = 0;
+        bool ret = get(v);
+        value = static_cast<int32_t>(v);
+        return ret;
+    }
+
+    bool get(
+            octet* bytes,
+            size_t size)
+    {
+        if (size_ - offset_ < size)
+        {
+            return false;
+        }
+        std::memcpy(bytes, data_ + offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    bool get(
+            fastrtps::rtps::GUID_t& guid)
+    {
+        return get(guid.guidPrefix.value, fastrtps::rtps::GuidPrefix_t::size) &&
+               get(guid.entityId.value, fastrtps::rtps::EntityId_t::size);
+    }
+
+    bool get(
+            fastrtps::rtps::SequenceNumber_t& sn)
+    {
+        return get(sn.high) && get(sn.low);
+    }
+
+    bool get(
+            fastrtps::rtps::Time_t& time)
+    {
+        int32_t seconds = 0;
+        uint32_t fraction = 0;
+        bool ret = get(seconds) && get(fraction);
+        time.seconds(seconds);
+        time.fraction(fraction);
+        return ret;
+    }
+
+    bool get(
+            fastrtps::rtps::SampleIdentity& identity)
+    {
+        return get(identity.writer_guid()) && get(identity.sequence_number());
+    }
+
+    bool at_end() const
+    {
+        return offset_ == size_;
+    }
+
+private:
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t offset_ = 0;
+};
+
+//! Size of the length prefix of each record
+constexpr size_t record_prefix_size = sizeof(uint32_t);
+
+//! Flush a file down to the storage device
+bool flush_to_disk(
+        FILE* file)
+{
+    if (0 != std::fflush(file))
+    {
+        return false;
+    }
+
+#if defined(_WIN32)
+    return 0 == _commit(_fileno(file));
+#elif defined(__APPLE__)
+    return 0 == fsync(fileno(file));
+#else
+    return 0 == fdatasync(fileno(file));
+#endif // if defined(_WIN32)
+}
+
+} // namespace
+
+BackupJournal::Record::Topic BackupJournal::Record::topic() const
+{
+    fastrtps::rtps::GUID_t guid = fastrtps::rtps::iHandle2GUID(instance_handle);
+    if (fastrtps::rtps::c_EntityId_RTPSParticipant == guid.entityId)
+    {
+        return Topic::PARTICIPANTS;
+    }
+
+    // RTPS Specification v2.3
+    //    - For writers: NO_KEY = 0x03, WITH_KEY = 0x02
+    //    - For built-in writers: NO_KEY = 0xc3, WITH_KEY = 0xc2
+    //    - For readers: NO_KEY = 0x04, WITH_KEY = 0x07
+    //    - For built-in readers: NO_KEY = 0xc4, WITH_KEY = 0xc7
+    // Furthermore, the Fast DDS Statistics Module defines an Entity ID for Statistics DataWriters
+    switch (guid.entityId.value[3])
+    {
+        case 0x02:
+        case 0x03:
+        case 0xc2:
+        case 0xc3:
+            return Topic::PUBLICATIONS;
+        case 0x04:
+        case 0x07:
+        case 0xc4:
+        case 0xc7:
+            return Topic::SUBSCRIPTIONS;
+        default:
+            break;
+    }
+
+    if (statistics::is_statistics_builtin(guid.entityId))
+    {
+        return Topic::PUBLICATIONS;
+    }
+
+    return Topic::UNKNOWN;
+}
+
+bool BackupJournal::Record::to_change(
+        fastrtps::rtps::CacheChange_t& change) const
+{
+    if (change.serializedPayload.max_size < payload.size())
+    {
+        return false;
+    }
+
+    change.kind = kind;
+    change.writerGUID = writer_guid;
+    change.instanceHandle = instance_handle;
+    change.sequenceNumber = sequence_number;
+    change.isRead = is_read;
+    change.sourceTimestamp = source_timestamp;
+    change.reader_info.receptionTimestamp = reception_timestamp;
+    change.write_params.sample_identity(sample_identity);
+    change.write_params.related_sample_identity(related_sample_identity);
+    change.serializedPayload.encapsulation = encapsulation;
+    change.serializedPayload.length = static_cast<uint32_t>(payload.size());
+    if (!payload.empty())
+    {
+        std::memcpy(change.serializedPayload.data, payload.data(), payload.size());
+    }
+    return true;
+}
+
+BackupJournal::~BackupJournal()
+{
+    close();
+}
+
+bool BackupJournal::open(
+        const std::string& file_name)
+{
+    close();
+
+    {
+        std::lock_guard<std::mutex> guard(file_mutex_);
+        // It opens the file in append mode because the info in it has not been yet dumped into the database backup
+        file_ = std::fopen(file_name.c_str(), "ab");
+        if (nullptr == file_)
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Could not open backup journal " << file_name);
+            return false;
+        }
+        file_name_ = file_name;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    running_ = true;
+    thread_ = std::thread(&BackupJournal::run, this);
+    return true;
+}
+
+void BackupJournal::close()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        running_ = false;
+    }
+    cv_.notify_one();
+    written_cv_.notify_all();
+
+    // The writing thread drains the pending records before exiting
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    std::lock_guard<std::mutex> guard(file_mutex_);
+    if (nullptr != file_)
+    {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool BackupJournal::append(
+        const fastrtps::rtps::CacheChange_t& change)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    // A single record is accepted on an empty buffer whatever its size
+    if (!running_ || max_pending_bytes_ <= pending_.size())
+    {
+        return false;
+    }
+
+    bool was_empty = pending_.empty();
+    encode(change, pending_);
+    ++appended_;
+
+    if (was_empty)
+    {
+        cv_.notify_one();
+    }
+    return true;
+}
+
+void BackupJournal::sync()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t target = appended_;
+    written_cv_.wait(lock, [this, target]()
+            {
+                return !running_ || written_ >= target;
+            });
+}
+
+void BackupJournal::truncate()
+{
+    std::lock_guard<std::mutex> file_guard(file_mutex_);
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        pending_.clear();
+        ++generation_;
+        // Discarded records are part of the database dump, so they count as written
+        written_ = appended_;
+    }
+    written_cv_.notify_all();
+
+    if (nullptr != file_)
+    {
+        // This will erase the records already written
+        file_ = std::freopen(file_name_.c_str(), "wb", file_);
+        if (nullptr == file_)
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Could not truncate backup journal " << file_name_);
+        }
+    }
+}
+
+void BackupJournal::encode(
+        const fastrtps::rtps::CacheChange_t& change,
+        std::vector<uint8_t>& buffer)
+{
+    const fastrtps::rtps::SerializedPayload_t& payload = change.serializedPayload;
+
+    // Reserve the length prefix and fill it once the record is complete
+    size_t record_start = buffer.size();
+    buffer.resize(record_start + record_prefix_size);
+
+    put(buffer, static_cast<uint8_t>(change.kind));
+    put(buffer, change.writerGUID);
+    const octet* instance_handle = change.instanceHandle.value;
+    buffer.insert(buffer.end(), instance_handle, instance_handle + 16);
+    put(buffer, change.sequenceNumber);
+    put(buffer, static_cast<uint8_t>(change.isRead));
+    put(buffer, change.sourceTimestamp);
+    put(buffer, change.reader_info.receptionTimestamp);
+    put(buffer, change.write_params.sample_identity());
+    put(buffer, change.write_params.related_sample_identity());
+    put(buffer, payload.encapsulation);
+    put(buffer, payload.length);
+    buffer.insert(buffer.end(), payload.data, payload.data + payload.length);
+
+    std::vector<uint8_t> prefix;
+    put(prefix, static_cast<uint32_t>(buffer.size() - record_start - record_prefix_size));
+    std::memcpy(&buffer[record_start], prefix.data(), record_prefix_size);
+}
+
+bool BackupJournal::read(
+        const std::string& file_name,
+        std::vector<Record>& records)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad())
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error reading backup journal " << file_name);
+        return false;
+    }
+
+    return decode(data.data(), data.size(), records);
+}
+
+bool BackupJournal::decode(
+        const uint8_t* data,
+        size_t size,
+        std::vector<Record>& records)
+{
+    size_t offset = 0;
+    while (offset < size)
+    {
+        RecordReader prefix(data + offset, size - offset);
+        uint32_t record_size = 0;
+        if (!prefix.get(record_size) || size - offset - record_prefix_size < record_size)
+        {
+            // The last write was interrupted before the record was completely written
+            EPROSIMA_LOG_WARNING(DISCOVERY_DATABASE, "Ignoring incomplete record at the end of backup journal");
+            break;
+        }
+        offset += record_prefix_size;
+
+        RecordReader reader(data + offset, record_size);
+        Record record;
+        uint8_t kind = 0;
+        uint8_t is_read = 0;
+        uint32_t payload_size = 0;
+        bool ok = reader.get(kind) &&
+                reader.get(record.writer_guid) &&
+                reader.get(record.instance_handle.value, 16) &&
+                reader.get(record.sequence_number) &&
+                reader.get(is_read) &&
+                reader.get(record.source_timestamp) &&
+                reader.get(record.reception_timestamp) &&
+                reader.get(record.sample_identity) &&
+                reader.get(record.related_sample_identity) &&
+                reader.get(record.encapsulation) &&
+                reader.get(payload_size) &&
+                payload_size <= record_size;
+        if (ok)
+        {
+            record.payload.resize(payload_size);
+            ok = reader.get(record.payload.data(), payload_size) && reader.at_end() &&
+                    kind <= fastrtps::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED;
+        }
+
+        if (!ok)
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Malformed record in backup journal");
+            return false;
+        }
+
+        record.kind = static_cast<fastrtps::rtps::ChangeKind_t>(kind);
+        record.is_read = 0 != is_read;
+        records.push_back(std::move(record));
+        offset += record_size;
+    }
+
+    return true;
+}
+
+void BackupJournal::run()
+{
+    std::vector<uint8_t> batch;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_ || !pending_.empty())
+    {
+        cv_.wait(lock, [this]()
+                {
+                    return !running_ || !pending_.empty();
+                });
+
+        if (pending_.empty())
+        {
+            continue;
+        }
+
+        batch.swap(pending_);
+        uint64_t generation = generation_;
+        uint64_t batch_end = appended_;
+        lock.unlock();
+
+        {
+            std::lock_guard<std::mutex> file_guard(file_mutex_);
+            // A truncation after taking the batch means its records are already part of the database dump
+            bool discarded = false;
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                discarded = generation != generation_;
+            }
+
+            if (!discarded && nullptr != file_)
+            {
+                if (std::fwrite(batch.data(), 1, batch.size(), file_) != batch.size() || !flush_to_disk(file_))
+                {
+                    EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error writing backup journal " << file_name_);
+                }
+            }
+        }
+        batch.clear();
+
+        lock.lock();
+        if (written_ < batch_end)
+        {
+            written_ = batch_end;
+        }
+        written_cv_.notify_all();
+    }
+}
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,224 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BackupJournal.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_BACKUP_JOURNAL_H_
+#define _FASTDDS_RTPS_DISCOVERY_BACKUP_JOURNAL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/**
+ * Append-only binary journal used by the Discovery Server to store every change received since the last
+ * database dump.
+ *
+ * Each record is a length prefix followed by the change metadata and its serialized payload. Every integer is
+ * stored in little endian, so journals can be restored on any platform.
+ *
+ * Encoding a change only copies its bytes into a pending buffer, so it can be done inside the data queue
+ * critical section. The pending buffer is written and synced to the storage device by a dedicated thread,
+ * coalescing all the records appended while the previous batch was being written. Nobody waits for the disk on
+ * the reception or the discovery paths.
+ * The pending buffer is bounded: @ref append never blocks, and drops the record when the buffer is full.
+ * Changes whose record is dropped or not yet on disk are part of the database dump the server writes once it
+ * has processed them. A crash before that can only lose changes that remote participants announce again.
+ */
+class BackupJournal
+{
+public:
+
+    //! Change stored on a journal record
+    struct Record
+    {
+        fastrtps::rtps::ChangeKind_t kind = fastrtps::rtps::ALIVE;
+        fastrtps::rtps::GUID_t writer_guid;
+        fastrtps::rtps::InstanceHandle_t instance_handle;
+        fastrtps::rtps::SequenceNumber_t sequence_number;
+        bool is_read = false;
+        fastrtps::rtps::Time_t source_timestamp;
+        fastrtps::rtps::Time_t reception_timestamp;
+        fastrtps::rtps::SampleIdentity sample_identity;
+        fastrtps::rtps::SampleIdentity related_sample_identity;
+        uint16_t encapsulation = 0;
+        std::vector<fastrtps::rtps::octet> payload;
+
+        //! Builtin topics a journaled change can belong to
+        enum class Topic
+        {
+            PARTICIPANTS,
+            PUBLICATIONS,
+            SUBSCRIPTIONS,
+            UNKNOWN
+        };
+
+        /**
+         * Builtin topic of the change, from the kind of the entity it announces.
+         * It does not depend on the database, so it also classifies entities discovered after the last dump.
+         * @return UNKNOWN if the entity is neither a participant, a writer nor a reader.
+         */
+        Topic topic() const;
+
+        /**
+         * Copy the record into a change.
+         * @param change Change to fill. Its payload should have room for the payload of the record.
+         * @return false if the payload of the record does not fit on the change.
+         */
+        bool to_change(
+                fastrtps::rtps::CacheChange_t& change) const;
+    };
+
+    //! Default limit of bytes waiting to be written
+    static constexpr size_t default_max_pending_bytes = 1024 * 1024;
+
+    explicit BackupJournal(
+            size_t max_pending_bytes = default_max_pending_bytes)
+        : max_pending_bytes_(max_pending_bytes)
+    {
+    }
+
+    ~BackupJournal();
+
+    BackupJournal(
+            const BackupJournal&) = delete;
+
+    BackupJournal& operator =(
+            const BackupJournal&) = delete;
+
+    /**
+     * Open the journal file in append mode and start the writing thread.
+     * @param file_name Path of the journal file.
+     * @return true if the file could be opened.
+     */
+    bool open(
+            const std::string& file_name);
+
+    /**
+     * Write all pending records, stop the writing thread and close the file.
+     */
+    void close();
+
+    /**
+     * Encode a change and queue it to be written to the journal.
+     * @param change Change to store. Its payload is copied, so it may be released right after the call.
+     * @return false if the record is dropped, because the pending records exceed the configured limit or the
+     * journal is not open.
+     */
+    bool append(
+            const fastrtps::rtps::CacheChange_t& change);
+
+    /**
+     * Block until every record appended before the call has been written and synced to the file.
+     */
+    void sync();
+
+    /**
+     * Discard every record, both pending and already written.
+     * Called after a full dump of the database, which already contains the state of the discarded records.
+     */
+    void truncate();
+
+    /**
+     * Encode a change as a journal record.
+     * @param change Change to encode.
+     * @param buffer Buffer where the record is appended.
+     */
+    static void encode(
+            const fastrtps::rtps::CacheChange_t& change,
+            std::vector<uint8_t>& buffer);
+
+    /**
+     * Read every record of a journal file.
+     * An incomplete record at the end of the file, left by a crash while it was being written, is ignored.
+     * @param file_name Path of the journal file.
+     * @param records Vector where the records are appended.
+     * @return false if the file cannot be read or contains a malformed record.
+     */
+    static bool read(
+            const std::string& file_name,
+            std::vector<Record>& records);
+
+    /**
+     * Decode the records of a journal.
+     * @param data Contents of the journal.
+     * @param size Number of bytes of @c data.
+     * @param records Vector where the records are appended.
+     * @return false if a malformed record is found.
+     */
+    static bool decode(
+            const uint8_t* data,
+            size_t size,
+            std::vector<Record>& records);
+
+private:
+
+    void run();
+
+    const size_t max_pending_bytes_;
+
+    std::string file_name_;
+
+    //! Protects file_ against concurrent truncation and writing
+    std::mutex file_mutex_;
+
+    FILE* file_ = nullptr;
+
+    //! Protects the pending records and the thread state
+    std::mutex mutex_;
+
+    //! Wakes up the writing thread
+    std::condition_variable cv_;
+
+    //! Notified when a batch is written
+    std::condition_variable written_cv_;
+
+    //! Records not yet handed to the writing thread
+    std::vector<uint8_t> pending_;
+
+    //! Number of records appended
+    uint64_t appended_ = 0;
+
+    //! Number of appended records already written or discarded
+    uint64_t written_ = 0;
+
+    //! Incremented on each truncation, so batches taken before it are discarded
+    uint64_t generation_ = 0;
+
+    bool running_ = false;
+
+    std::thread thread_;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_BACKUP_JOURNAL_H_ */
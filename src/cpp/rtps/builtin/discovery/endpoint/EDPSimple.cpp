@@ -25,6 +25,7 @@
 #include <fastdds/rtps/writer/StatefulWriter.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/attributes/WriterAttributes.h>
 #include <fastdds/rtps/attributes/ReaderAttributes.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
@@ -466,6 +467,15 @@ void EDPSimple::set_builtin_writer_attributes(
     attributes.endpoint.reliabilityKind = RELIABLE;
     attributes.endpoint.durabilityKind = TRANSIENT_LOCAL;
     attributes.endpoint.topicKind = WITH_KEY;
+
+    // Local endpoints can be announced from the asynchronous flow controller thread. Then creating an endpoint
+    // does not wait for its announcement to be sent, and the ones created in a burst share the same messages.
+    const std::string* async_announcements =
+            PropertyPolicyHelper::find_property(pattr.properties, "fastdds.edp_async_announcements");
+    if (nullptr != async_announcements && "true" == *async_announcements)
+    {
+        attributes.mode = ASYNCHRONOUS_WRITER;
+    }
 }
 
 bool EDPSimple::createSEDPEndpoints()
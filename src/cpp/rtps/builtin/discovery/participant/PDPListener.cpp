@@ -97,37 +97,65 @@ void PDPListener::onNewCacheChangeAdded(
             return;
         }
 
+        // Check if participant already exists (updated info)
+        ParticipantProxyData* pdata = nullptr;
+        for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+        {
+            if (guid == it->m_guid)
+            {
+                pdata = it;
+                break;
+            }
+        }
+
+        // Periodic announcements are usually identical to the last one received from the same participant.
+        // In that case the proxy already holds its contents, so the deserialization of the whole parameter list is
+        // skipped. The announcement is processed as any other update afterwards.
+        bool is_unchanged = (nullptr != pdata) && pdata->is_last_announcement(change->serializedPayload);
+
         // Access to temp_participant_data_ is protected by reader lock
 
         // Load information on temp_participant_data_
         CDRMessage_t msg(change->serializedPayload);
         temp_participant_data_.clear();
-        if (temp_participant_data_.readFromCDRMessage(&msg, true, parent_pdp_->getRTPSParticipant()->network_factory(),
+        if (is_unchanged ||
+                temp_participant_data_.readFromCDRMessage(&msg, true,
+                parent_pdp_->getRTPSParticipant()->network_factory(),
                 parent_pdp_->getRTPSParticipant()->has_shm_transport()))
         {
-            // After correctly reading it
-            change->instanceHandle = temp_participant_data_.m_key;
-            guid = temp_participant_data_.m_guid;
+            if (is_unchanged)
+            {
+                EPROSIMA_LOG_INFO(RTPS_PDP_DISCOVERY, "Unchanged announcement from participant " << guid);
+            }
+            else
+            {
+                // After correctly reading it
+                change->instanceHandle = temp_participant_data_.m_key;
+                guid = temp_participant_data_.m_guid;
+            }
 
             if (parent_pdp_->getRTPSParticipant()->is_participant_ignored(guid.guidPrefix))
             {
                 return;
             }
 
-            // Filter locators
-            const auto& pattr = parent_pdp_->getRTPSParticipant()->getAttributes();
-            fastdds::rtps::ExternalLocatorsProcessor::filter_remote_locators(temp_participant_data_,
-                    pattr.builtin.metatraffic_external_unicast_locators, pattr.default_external_unicast_locators,
-                    pattr.ignore_non_matching_locators);
-
-            // Check if participant already exists (updated info)
-            ParticipantProxyData* pdata = nullptr;
-            for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+            if (!is_unchanged)
             {
-                if (guid == it->m_guid)
+                // Filter locators
+                const auto& pattr = parent_pdp_->getRTPSParticipant()->getAttributes();
+                fastdds::rtps::ExternalLocatorsProcessor::filter_remote_locators(temp_participant_data_,
+                        pattr.builtin.metatraffic_external_unicast_locators, pattr.default_external_unicast_locators,
+                        pattr.ignore_non_matching_locators);
+
+                // The GUID on the announcement may differ from the one taken from the instance handle
+                pdata = nullptr;
+                for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
                 {
-                    pdata = it;
-                    break;
+                    if (guid == it->m_guid)
+                    {
+                        pdata = it;
+                        break;
+                    }
                 }
             }
 
@@ -138,6 +166,10 @@ void PDPListener::onNewCacheChangeAdded(
             {
                 // Create a new one when not found
                 pdata = parent_pdp_->createParticipantProxyData(temp_participant_data_, writer_guid);
+                if (pdata != nullptr)
+                {
+                    pdata->set_last_announcement(change->serializedPayload);
+                }
 
                 reader->getMutex().unlock();
                 lock.unlock();
@@ -186,7 +218,11 @@ void PDPListener::onNewCacheChangeAdded(
             }
             else
             {
-                pdata->updateData(temp_participant_data_);
+                if (!is_unchanged)
+                {
+                    pdata->updateData(temp_participant_data_);
+                    pdata->set_last_announcement(change->serializedPayload);
+                }
                 pdata->isAlive = true;
                 reader->getMutex().unlock();
 
@@ -219,7 +255,7 @@ void PDPListener::onNewCacheChangeAdded(
                     }
                     if (should_be_ignored)
                     {
-                        parent_pdp_->getRTPSParticipant()->ignore_participant(temp_participant_data_.m_guid.guidPrefix);
+                        parent_pdp_->getRTPSParticipant()->ignore_participant(guid.guidPrefix);
                     }
                 }
             }
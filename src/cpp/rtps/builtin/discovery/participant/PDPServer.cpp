@@ -70,6 +70,7 @@ PDPServer::PDPServer(
     , discovery_db_(builtin->mp_participantImpl->getGuid().guidPrefix,
             servers_prefixes())
     , durability_ (durability_kind)
+    , database_changed_(true)
 {
     // Add remote servers from environment variable
     RemoteServerList_t env_servers;
@@ -124,7 +125,7 @@ bool PDPServer::init(
         return false;
     }
 
-    std::vector<nlohmann::json> backup_queue;
+    std::vector<ddb::BackupJournal::Record> backup_queue;
     if (durability_ == TRANSIENT)
     {
         nlohmann::json backup_json;
@@ -160,7 +161,7 @@ bool PDPServer::init(
     getRTPSParticipant()->enableReader(edp->publications_reader_.first);
 
     // Initialize server dedicated thread.
-    resource_event_thread_.init_thread();
+    resource_event_thread_.init_thread(getRTPSParticipant()->getAttributes().discovery_server_thread, "dds.ds_ev");
 
     /*
         Given the fact that a participant is either a client or a server the
@@ -182,7 +183,6 @@ bool PDPServer::init(
     // Restoring the queue must be done after starting the routine
     if (durability_ == TRANSIENT)
     {
-        // This vector is empty till backup queue is implemented
         process_backup_restore_queue(backup_queue);
     }
 
@@ -806,7 +806,7 @@ std::string PDPServer::get_ddb_persistence_file_name() const
 std::string PDPServer::get_ddb_queue_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
-    filename << "_queue.json";
+    filename << "_queue.bin";
     return filename.str();
 }
 
@@ -1105,6 +1105,11 @@ bool PDPServer::remove_remote_participant(
 bool PDPServer::process_data_queues()
 {
     EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "process_data_queues start");
+    if (!discovery_db_.data_queue_empty())
+    {
+        // New data may change the relevance and acknowledgement status of the changes in the histories
+        database_changed_ = true;
+    }
     discovery_db_.process_pdp_data_queue();
     return discovery_db_.process_edp_data_queue();
 }
@@ -1207,6 +1212,7 @@ void PDPServer::update_remote_servers_list()
     {
         discovery_db_.add_server(server.guidPrefix);
     }
+    database_changed_ = true;
 }
 
 bool PDPServer::process_writers_acknowledgements()
@@ -1215,28 +1221,53 @@ bool PDPServer::process_writers_acknowledgements()
 
     auto endpoints = static_cast<fastdds::rtps::DiscoveryServerPDPEndpoints*>(builtin_endpoints_.get());
 
+    // Clear the flag before processing, so changes notified meanwhile are checked on the next run
+    bool database_changed = database_changed_.exchange(false);
+
     // Execute first ACK for endpoints because PDP acked changes relevance in EDP,
     //  which can result in false positives in EDP acknowledgements.
 
     /* EDP Subscriptions Writer's History */
     EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
-    bool pending = process_history_acknowledgement(edp->subscriptions_writer_.first, edp->subscriptions_writer_.second);
+    bool pending = process_history_acknowledgement(edp->subscriptions_writer_.first, edp->subscriptions_writer_.second,
+                    database_changed);
 
     /* EDP Publications Writer's History */
-    pending |= process_history_acknowledgement(edp->publications_writer_.first, edp->publications_writer_.second);
+    pending |= process_history_acknowledgement(edp->publications_writer_.first, edp->publications_writer_.second,
+                    database_changed);
 
     /* PDP Writer's History */
-    pending |= process_history_acknowledgement(endpoints->writer.writer_, endpoints->writer.history_.get());
+    uint64_t participant_acks_generation = discovery_db_.participant_acks_generation();
+    pending |= process_history_acknowledgement(endpoints->writer.writer_, endpoints->writer.history_.get(),
+                    database_changed);
+
+    // New DATA(p) acknowledgements make EDP changes relevant to the participants that sent them, so the EDP
+    // histories cannot be skipped on the next run
+    if (participant_acks_generation != discovery_db_.participant_acks_generation())
+    {
+        database_changed_ = true;
+    }
 
     return pending;
 }
 
 bool PDPServer::process_history_acknowledgement(
         fastrtps::rtps::StatefulWriter* writer,
-        fastrtps::rtps::WriterHistory* writer_history)
+        fastrtps::rtps::WriterHistory* writer_history,
+        bool database_changed)
 {
     std::unique_lock<fastrtps::RecursiveTimedMutex> lock(writer->getMutex());
 
+    // The outcome of checking every change only depends on the acknowledgements received by the writer, the
+    // changes in its history and the database. If none of them has changed since last time, skip the check.
+    auto state_it = acknowledgement_states_.find(writer);
+    if (!database_changed && state_it != acknowledgement_states_.end() &&
+            state_it->second == get_acknowledgement_state_nts(writer, writer_history))
+    {
+        EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "No acknowledgement changes in writer " << writer->getGuid());
+        return writer_history->getHistorySize() > 1;
+    }
+
     // Iterate over changes in writer's history
     for (auto it = writer_history->changesBegin(); it != writer_history->changesEnd();)
     {
@@ -1245,9 +1276,23 @@ bool PDPServer::process_history_acknowledgement(
             writer,
             writer_history);
     }
+
+    acknowledgement_states_[writer] = get_acknowledgement_state_nts(writer, writer_history);
     return writer_history->getHistorySize() > 1;
 }
 
+PDPServer::HistoryAcknowledgementState PDPServer::get_acknowledgement_state_nts(
+        const fastrtps::rtps::StatefulWriter* writer,
+        fastrtps::rtps::WriterHistory* writer_history)
+{
+    HistoryAcknowledgementState state;
+    state.acknowledgement_generation = writer->acknowledgement_generation();
+    state.next_sequence_number = writer_history->next_sequence_number();
+    state.history_size = writer_history->getHistorySize();
+    state.server_acked_by_all = discovery_db_.server_acked_by_all();
+    return state;
+}
+
 History::iterator PDPServer::process_change_acknowledgement(
         fastrtps::rtps::History::iterator cit,
         fastrtps::rtps::StatefulWriter* writer,
@@ -1685,7 +1730,7 @@ void PDPServer::send_announcement(
 
 bool PDPServer::read_backup(
         nlohmann::json& ddb_json,
-        std::vector<nlohmann::json>& /* new_changes */)
+        std::vector<ddb::BackupJournal::Record>& new_changes)
 {
     std::ifstream myfile;
     bool ret = true;
@@ -1701,25 +1746,12 @@ bool PDPServer::read_backup(
         ret = false;
     }
 
-    // TODO uncomment this part when recover queues is finish
-    // try{
-    //     myfile.open(get_ddb_queue_persistence_file_name(), std::ios_base::in);
-
-    //     std::string line;
-    //     while (std::getline(myfile, line))
-    //     {
-    //         nlohmann::json change_json = nlohmann::json::parse(line);
-
-    //         // Read every change, and store it in json format in a vector
-    //         new_changes.push_back(change_json);
-    //     }
+    // The journal may not exist if no change was received after the last dump
+    if (!ddb::BackupJournal::read(get_ddb_queue_persistence_file_name(), new_changes))
+    {
+        new_changes.clear();
+    }
 
-    //     myfile.close();
-    // }
-    // catch(const std::exception& e)
-    // {
-    //     return ret;
-    // }
     return ret;
 }
 
@@ -1870,134 +1902,64 @@ bool PDPServer::process_backup_discovery_database_restore(
 }
 
 bool PDPServer::process_backup_restore_queue(
-        std::vector<nlohmann::json>& /* new_changes */)
+        std::vector<ddb::BackupJournal::Record>& new_changes)
 {
-    // fastrtps::rtps::SampleIdentity sample_identity_aux;
-    // fastrtps::rtps::InstanceHandle_t instance_handle_aux;
-    // uint32_t length;
-
-    // EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
-    // EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
-    // EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
-
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
-
-    // TODO uncomment this funcionality and update with pools when queue functionality is implemented
-    // try
-    // {
-    //     // Read every change and push it to the listener that it belongs
-    //     for (nlohmann::json& json_change : new_changes)
-    //     {
-    //         // std::cout << json_change << std::endl;
-    //         fastrtps::rtps::CacheChange_t* change_aux;
-    //         length = json_change["serialized_payload"]["length"].get<std::uint32_t>();
-    //         (std::istringstream) json_change["sample_identity"].get<std::string>() >> sample_identity_aux;
-    //         (std::istringstream) json_change["instance_handle"].get<std::string>() >> instance_handle_aux;
-
-    //         // Belongs to own server
-    //         if (sample_identity_aux.writer_guid() == endpoints->writer.writer_->getGuid())
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!endpoints->writer.history_->reserve_Cache(&change_aux, length))
-    //                             [this]() -> uint32_t
-    //                             {
-    //                                 return mp_PDP->builtin_attributes().readerPayloadSize;
-    //                             },
-    //                             &change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(endpoints->reader.reader_, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //         // It came from outside
-    //         else
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!endpoints->reader.history_->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(endpoints->reader.reader_, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //     }
-    // }
-    // catch (std::ios_base::failure&)
-    // {
-    //     // TODO clean changes in case it has been an error
-    //     EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "QUEUE BACKUP CORRUPTED");
-    //     return false;
-    // }
-    return true;
+    EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+    EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
+    EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
+
+    // These mutexes are necessary to send messages to the listeners
+    auto endpoints = static_cast<fastdds::rtps::DiscoveryServerPDPEndpoints*>(builtin_endpoints_.get());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    bool ret = true;
+
+    // Push every change to the listener of the reader it was received on. The own server changes are never
+    // journaled, so all of them came from outside.
+    // The replayed changes are journaled again, and the duplicates dropped by the next database dump.
+    for (const ddb::BackupJournal::Record& record : new_changes)
+    {
+        GUID_t entity_guid = iHandle2GUID(record.instance_handle);
+        fastrtps::rtps::RTPSReader* reader = nullptr;
+        fastrtps::rtps::ReaderListener* listener = nullptr;
+
+        // Entities discovered after the last dump are only on the journal, so the database cannot be used here
+        switch (record.topic())
+        {
+            case ddb::BackupJournal::Record::Topic::PARTICIPANTS:
+                reader = endpoints->reader.reader_;
+                listener = mp_listener;
+                break;
+            case ddb::BackupJournal::Record::Topic::PUBLICATIONS:
+                reader = edp->publications_reader_.first;
+                listener = edp_pub_listener;
+                break;
+            case ddb::BackupJournal::Record::Topic::SUBSCRIPTIONS:
+                reader = edp->subscriptions_reader_.first;
+                listener = edp_sub_listener;
+                break;
+            default:
+                break;
+        }
+
+        fastrtps::rtps::CacheChange_t* change_aux = nullptr;
+        if (nullptr != reader && reader->reserveCache(&change_aux, static_cast<uint32_t>(record.payload.size())))
+        {
+            if (record.to_change(*change_aux))
+            {
+                listener->onNewCacheChangeAdded(reader, change_aux);
+                continue;
+            }
+            reader->releaseCache(change_aux);
+        }
+
+        EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error restoring change of entity " << entity_guid << " from backup");
+        ret = false;
+    }
+
+    return ret;
 }
 
 void PDPServer::process_backup_store()
@@ -23,6 +23,8 @@
 
 #include <fastdds/rtps/builtin/discovery/participant/PDP.h>
 
+#include <atomic>
+#include <map>
 #include <set>
 #include <sstream>
 #include <string>
@@ -211,7 +213,8 @@ protected:
 
     bool process_history_acknowledgement(
             fastrtps::rtps::StatefulWriter* writer,
-            fastrtps::rtps::WriterHistory* writer_history);
+            fastrtps::rtps::WriterHistory* writer_history,
+            bool database_changed);
 
     fastrtps::rtps::History::iterator process_change_acknowledgement(
             fastrtps::rtps::History::iterator c,
@@ -264,14 +267,14 @@ protected:
     // It reserves memory for the changes depending the pool, and send them by the listener to the DDB
     // This method must be called with the DDB variable backup_in_progress as false
     bool process_backup_restore_queue(
-            std::vector<nlohmann::json>& new_changes);
+            std::vector<ddb::BackupJournal::Record>& new_changes);
 
     // Reads the two backup files and stores each json objects in both arguments
     // The first argument has the json object to restore the DDB
-    // The second argument has the json vector object to restore the changes that must be sent again to the queue
+    // The second argument has the journaled changes that must be sent again to the queue
     bool read_backup(
             nlohmann::json& ddb_json,
-            std::vector<nlohmann::json>& new_changes);
+            std::vector<ddb::BackupJournal::Record>& new_changes);
 
     std::set<fastrtps::rtps::GuidPrefix_t> servers_prefixes();
 
@@ -378,6 +381,36 @@ private:
     //! TRANSIENT or TRANSIENT_LOCAL durability;
     fastrtps::rtps::DurabilityKind_t durability_;
 
+    //! State of a writer and its history that determines the outcome of process_history_acknowledgement
+    struct HistoryAcknowledgementState
+    {
+        uint64_t acknowledgement_generation = 0;
+        fastrtps::rtps::SequenceNumber_t next_sequence_number;
+        size_t history_size = 0;
+        bool server_acked_by_all = false;
+
+        bool operator ==(
+                const HistoryAcknowledgementState& other) const
+        {
+            return acknowledgement_generation == other.acknowledgement_generation &&
+                   next_sequence_number == other.next_sequence_number &&
+                   history_size == other.history_size &&
+                   server_acked_by_all == other.server_acked_by_all;
+        }
+
+    };
+
+    //! Get the current HistoryAcknowledgementState of a writer. Must be called with the writer mutex taken.
+    HistoryAcknowledgementState get_acknowledgement_state_nts(
+            const fastrtps::rtps::StatefulWriter* writer,
+            fastrtps::rtps::WriterHistory* writer_history);
+
+    //! State of each builtin writer the last time its acknowledgements were processed
+    std::map<const fastrtps::rtps::StatefulWriter*, HistoryAcknowledgementState> acknowledgement_states_;
+
+    //! Whether the database may have changed the relevance of any change since acknowledgements were processed
+    std::atomic<bool> database_changed_;
+
 };
 
 } // namespace rtps
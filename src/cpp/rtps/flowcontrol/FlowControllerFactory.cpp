@@ -15,9 +15,14 @@ const char* const async_statistics_flow_controller_name = "AsyncStatisticsFlowCo
 #endif // ifndef FASTDDS_STATISTICS
 
 void FlowControllerFactory::init(
-        fastrtps::rtps::RTPSParticipantImpl* participant)
+        fastrtps::rtps::RTPSParticipantImpl* participant,
+        const ThreadSettings& builtin_sender_thread)
 {
     participant_ = participant;
+
+    FlowControllerDescriptor async_descriptor;
+    async_descriptor.sender_thread = builtin_sender_thread;
+
     // Create default flow controllers.
 
     // PureSyncFlowController -> used by volatile besteffort writers.
@@ -37,14 +42,14 @@ void FlowControllerFactory::init(
                 async_flow_controller_name,
                 std::unique_ptr<FlowController>(
                     new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                    FlowControllerFifoSchedule>(participant_, nullptr))));
+                    FlowControllerFifoSchedule>(participant_, &async_descriptor))));
 
 #ifdef FASTDDS_STATISTICS
     flow_controllers_.insert(decltype(flow_controllers_)::value_type(
                 async_statistics_flow_controller_name,
                 std::unique_ptr<FlowController>(
                     new FlowControllerImpl<FlowControllerAsyncPublishMode,
-                    FlowControllerFifoSchedule>(participant_, nullptr))));
+                    FlowControllerFifoSchedule>(participant_, &async_descriptor))));
 #endif // ifndef FASTDDS_STATISTICS
 }
 
@@ -36,9 +36,11 @@ public:
      * Call always before use it.
      *
      * @param participant Pointer to the participant owner of this object.
+     * @param builtin_sender_thread Thread settings for the sender threads of the default asynchronous flow controllers.
      */
     void init(
-            fastrtps::rtps::RTPSParticipantImpl* participant);
+            fastrtps::rtps::RTPSParticipantImpl* participant,
+            const ThreadSettings& builtin_sender_thread);
 
     /*!
      * Registers a new flow controller.
@@ -4,6 +4,7 @@
 #include "FlowController.hpp"
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <utils/threading.hpp>
 
 #include <atomic>
 #include <cassert>
@@ -197,9 +198,13 @@ struct FlowControllerAsyncPublishMode
 {
     FlowControllerAsyncPublishMode(
             fastrtps::rtps::RTPSParticipantImpl* participant,
-            const FlowControllerDescriptor*)
+            const FlowControllerDescriptor* descriptor)
         : group(participant, true)
     {
+        if (nullptr != descriptor)
+        {
+            thread_settings = descriptor->sender_thread;
+        }
     }
 
     virtual ~FlowControllerAsyncPublishMode()
@@ -240,6 +245,8 @@ struct FlowControllerAsyncPublishMode
 
     std::thread thread;
 
+    ThreadSettings thread_settings;
+
     std::atomic_bool running {false};
 
     std::condition_variable cv;
@@ -1146,9 +1153,20 @@ private:
         // This call should be made with writer's mutex locked.
         fastrtps::rtps::LocatorSelectorSender& locator_selector = writer->get_general_locator_selector();
         std::lock_guard<fastrtps::rtps::LocatorSelectorSender> lock(locator_selector);
-        fastrtps::rtps::RTPSMessageGroup group(participant_, writer, &locator_selector);
-        if (fastrtps::rtps::DeliveryRetCode::DELIVERED !=
-                writer->deliver_sample_nts(change, group, locator_selector, max_blocking_time))
+        fastrtps::rtps::DeliveryRetCode ret_delivery = fastrtps::rtps::DeliveryRetCode::DELIVERED;
+        fastrtps::rtps::RTPSMessageGroup* batch_group = writer->sample_batch_group_nts();
+        if (nullptr != batch_group)
+        {
+            // The writer is grouping samples, which will be sent when its batch ends.
+            ret_delivery = writer->deliver_sample_nts(change, *batch_group, locator_selector, max_blocking_time);
+        }
+        else
+        {
+            fastrtps::rtps::RTPSMessageGroup group(participant_, writer, &locator_selector);
+            ret_delivery = writer->deliver_sample_nts(change, group, locator_selector, max_blocking_time);
+        }
+
+        if (fastrtps::rtps::DeliveryRetCode::DELIVERED != ret_delivery)
         {
             return enqueue_new_sample_impl(writer, change, max_blocking_time);
         }
@@ -1257,6 +1275,8 @@ private:
      */
     void run()
     {
+        configure_current_thread(async_mode.thread_settings, "dds.asyn", 0);
+
         while (async_mode.running)
         {
             // There are writers interested in removing a sample.
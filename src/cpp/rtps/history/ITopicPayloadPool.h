@@ -86,6 +86,22 @@ public:
      */
     virtual size_t payload_pool_available_size() const = 0;
 
+    /**
+     * @brief Check whether the payloads owned by a pool are the payloads of this pool.
+     *
+     * Pools wrapping another pool hand out the payloads of the wrapped pool, which is the one set as owner on
+     * the changes.
+     *
+     * @param [in]  owner  Payload owner of a change.
+     *
+     * @return true when the payloads of @c owner belong to this pool, false otherwise.
+     */
+    virtual bool is_payload_owner(
+            const IPayloadPool* owner) const
+    {
+        return this == owner;
+    }
+
 };
 
 }  // namespace rtps
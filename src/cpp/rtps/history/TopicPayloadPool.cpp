@@ -138,9 +138,23 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(cache_change.serializedPayload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
-        free_payloads_.push_back(payload);
+        std::unique_lock<std::mutex> lock(mutex_);
+        uint32_t data_index = PayloadNode::data_index(cache_change.serializedPayload.data);
+        PayloadNode* payload = all_payloads_.at(data_index);
+        if (all_payloads_.size() <= max_pool_size_)
+        {
+            free_payloads_.push_back(payload);
+        }
+        else
+        {
+            // The pool was shrunk while this payload was in use, so it is released now
+            all_payloads_.at(data_index) = all_payloads_.back();
+            all_payloads_.back()->data_index(data_index);
+            all_payloads_.pop_back();
+            lock.unlock();
+
+            delete payload;
+        }
     }
 
     cache_change.serializedPayload.length = 0;
@@ -262,9 +276,13 @@ void TopicPayloadPool::reserve (
 bool TopicPayloadPool::shrink (
         uint32_t max_num_payloads)
 {
-    assert(payload_pool_allocated_size() - payload_pool_available_size() <= max_num_payloads);
+    if (payload_pool_allocated_size() - payload_pool_available_size() > max_num_payloads)
+    {
+        // Payloads still referenced (e.g. by changes of a writer forwarding them) are released by release_payload()
+        EPROSIMA_LOG_WARNING(RTPS_HISTORY, "Shrinking a pool with more payloads in use than its new maximum");
+    }
 
-    while (max_num_payloads < all_payloads_.size())
+    while (max_num_payloads < all_payloads_.size() && !free_payloads_.empty())
     {
         PayloadNode* payload = free_payloads_.back();
         free_payloads_.pop_back();
@@ -276,7 +294,7 @@ bool TopicPayloadPool::shrink (
         delete payload;
     }
 
-    return true;
+    return max_num_payloads >= all_payloads_.size();
 }
 
 std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
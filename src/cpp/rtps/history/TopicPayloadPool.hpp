@@ -301,6 +301,8 @@ protected:
 
     /**
      * Ensures the pool has capacity for at most @c num_payloads elements.
+     * Only free payloads are released, so the pool may be left over @c max_num_payloads when more payloads are
+     * in use. Those are released when they are returned to the pool, as long as it is over its maximum size.
      *
      * @param [IN] max_num_payloads Maximum number of payloads reserved in the pool
      *
@@ -308,7 +310,7 @@ protected:
      *
      * @post
      *   - On success, payload_pool_allocated_size() <= max_num_payloads
-     *   - On failure, memory for some payloads may have been released, but payload_pool_allocated_size() > min_num_payloads
+     *   - On failure, memory for some payloads may have been released, but payload_pool_allocated_size() > max_num_payloads
      */
     bool shrink (
             uint32_t max_num_payloads);
@@ -100,6 +100,12 @@ public:
         return inner_pool_->payload_pool_available_size();
     }
 
+    bool is_payload_owner(
+            const IPayloadPool* owner) const override
+    {
+        return (this == owner) || inner_pool_->is_payload_owner(owner);
+    }
+
 private:
 
     std::string topic_name_;
@@ -23,6 +23,7 @@
 #include <fastdds/rtps/common/WriteParams.h>
 #include <fastdds/core/policy//ParameterSerializer.hpp>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -168,6 +169,55 @@ bool WriterHistory::matches_change(
     return inner_change->sequenceNumber == outer_change->sequenceNumber;
 }
 
+History::const_iterator WriterHistory::find_change_nts(
+        CacheChange_t* ch)
+{
+    if (mp_writer == nullptr || mp_mutex == nullptr)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_WRITER_HISTORY,
+                "You need to create a Writer with this History before using it");
+        return const_iterator();
+    }
+
+    if (nullptr == ch || m_changes.empty())
+    {
+        return changesEnd();
+    }
+
+    if (ch->writerGUID != mp_writer->getGuid())
+    {
+        EPROSIMA_LOG_ERROR(RTPS_WRITER_HISTORY,
+                "Change writerGUID " << ch->writerGUID << " different than Writer GUID " <<
+                mp_writer->getGuid());
+        return changesEnd();
+    }
+
+    const SequenceNumber_t& sequence_number = ch->sequenceNumber;
+    const SequenceNumber_t& first_sequence_number = m_changes.front()->sequenceNumber;
+    if (sequence_number < first_sequence_number || sequence_number > m_changes.back()->sequenceNumber)
+    {
+        return changesEnd();
+    }
+
+    // Changes are ordered by sequence number, and are usually consecutive
+    uint64_t offset = (sequence_number - first_sequence_number).to64long();
+    if (offset < m_changes.size() && m_changes[static_cast<size_t>(offset)]->sequenceNumber == sequence_number)
+    {
+        return changesBegin() + static_cast<std::ptrdiff_t>(offset);
+    }
+
+    const_iterator it = std::lower_bound(changesBegin(), changesEnd(), sequence_number,
+                    [](const CacheChange_t* change, const SequenceNumber_t& seq)
+                    {
+                        return change->sequenceNumber < seq;
+                    });
+    if (it != changesEnd() && (*it)->sequenceNumber != sequence_number)
+    {
+        it = changesEnd();
+    }
+    return it;
+}
+
 History::iterator WriterHistory::remove_change_nts(
         const_iterator removal,
         bool release)
@@ -309,7 +359,7 @@ void WriterHistory::set_fragments(
     {
         inline_qos_size += (2 * fastdds::dds::ParameterSerializer<Parameter_t>::PARAMETER_SAMPLE_IDENTITY_SIZE);
     }
-    if (ChangeKind_t::ALIVE != change->kind && TopicKind_t::WITH_KEY == mp_writer->m_att.topicKind)
+    if (ChangeKind_t::ALIVE != change->kind && TopicKind_t::WITH_KEY == mp_writer->getAttributes().topicKind)
     {
         inline_qos_size += fastdds::dds::ParameterSerializer<Parameter_t>::PARAMETER_KEY_SIZE;
         inline_qos_size += fastdds::dds::ParameterSerializer<Parameter_t>::PARAMETER_STATUS_SIZE;
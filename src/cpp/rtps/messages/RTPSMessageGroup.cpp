@@ -359,6 +359,53 @@ bool RTPSMessageGroup::insert_submessage(
     return true;
 }
 
+template<typename SerializeFunctor>
+bool RTPSMessageGroup::insert_submessage_in_place(
+        const SerializeFunctor& serialize_submessage,
+        const bool& is_big_submessage)
+{
+    auto try_serialize = [this, &serialize_submessage]() -> bool
+            {
+                uint32_t initial_length = full_msg_->length;
+#ifdef FASTDDS_STATISTICS
+                // Keep room for the statistics submessage by reducing max_size while serializing
+                full_msg_->max_size -= eprosima::fastdds::statistics::rtps::statistics_submessage_length;
+#endif // ifdef FASTDDS_STATISTICS
+                bool ret_val = CDRMessage::appendMsg(full_msg_, submessage_msg_) && serialize_submessage(full_msg_);
+#ifdef FASTDDS_STATISTICS
+                full_msg_->max_size += eprosima::fastdds::statistics::rtps::statistics_submessage_length;
+#endif // ifdef FASTDDS_STATISTICS
+                if (!ret_val)
+                {
+                    // Discard whatever was partially serialized
+                    full_msg_->length = initial_length;
+                    full_msg_->pos = initial_length;
+                }
+                return ret_val;
+            };
+
+    if (!try_serialize())
+    {
+        // Retry
+        flush_and_reset();
+        add_info_dst_in_buffer(full_msg_, sender_->destination_guid_prefix());
+
+        if (!try_serialize())
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER, "Cannot add RTPS submesage to the CDRMessage. Buffer too small");
+            return false;
+        }
+    }
+
+    // Messages with a submessage bigger than 64KB cannot have more submessages and should be flushed
+    if (is_big_submessage)
+    {
+        flush();
+    }
+
+    return true;
+}
+
 bool RTPSMessageGroup::add_info_dst_in_buffer(
         CDRMessage_t* buffer,
         const GuidPrefix_t& destination_guid_prefix)
@@ -452,8 +499,11 @@ bool RTPSMessageGroup::add_data(
     InlineQosWriter* inline_qos;
     inline_qos = (change.inline_qos.length > 0 && nullptr != change.inline_qos.data) ? &qos_writer : nullptr;
 
+    // Submessage protection needs the submessage apart, so it can be encoded before adding it to the message
+    bool serialize_in_place = true;
 #if HAVE_SECURITY
     uint32_t from_buffer_position = submessage_msg_->pos;
+    serialize_in_place = !endpoint_->getAttributes().security_attributes().is_submessage_protected;
 #endif // if HAVE_SECURITY
     const EntityId_t& readerId = get_entity_id(sender_->remote_guids());
 
@@ -487,7 +537,20 @@ bool RTPSMessageGroup::add_data(
 #endif // if HAVE_SECURITY
 
     // TODO (Ricardo). Check to create special wrapper.
-    bool is_big_submessage;
+    bool is_big_submessage = false;
+    if (serialize_in_place)
+    {
+        // Only the INFO_DST / INFO_TS prefix is staged, the DATA goes directly into the outgoing message
+        bool ret_val = insert_submessage_in_place(
+            [&](CDRMessage_t* msg)
+            {
+                return RTPSMessageCreator::addSubmessageData(msg, &change_to_add,
+                endpoint_->getAttributes().topicKind, readerId, expectsInlineQos, inline_qos, &is_big_submessage);
+            }, is_big_submessage);
+        change_to_add.serializedPayload.data = nullptr;
+        return ret_val;
+    }
+
     if (!RTPSMessageCreator::addSubmessageData(submessage_msg_, &change_to_add, endpoint_->getAttributes().topicKind,
             readerId, expectsInlineQos, inline_qos, &is_big_submessage))
     {
@@ -555,8 +618,11 @@ bool RTPSMessageGroup::add_data_frag(
     InlineQosWriter* inline_qos;
     inline_qos = (change.inline_qos.length > 0 && nullptr != change.inline_qos.data) ? &qos_writer : nullptr;
 
+    // Submessage protection needs the submessage apart, so it can be encoded before adding it to the message
+    bool serialize_in_place = true;
 #if HAVE_SECURITY
     uint32_t from_buffer_position = submessage_msg_->pos;
+    serialize_in_place = !endpoint_->getAttributes().security_attributes().is_submessage_protected;
 #endif // if HAVE_SECURITY
     const EntityId_t& readerId = get_entity_id(sender_->remote_guids());
 
@@ -590,6 +656,21 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    if (serialize_in_place)
+    {
+        // Only the INFO_DST / INFO_TS prefix is staged, the DATA_FRAG goes directly into the outgoing message
+        bool is_big_submessage = false;
+        bool ret_val = insert_submessage_in_place(
+            [&](CDRMessage_t* msg)
+            {
+                return RTPSMessageCreator::addSubmessageDataFrag(msg, &change, fragment_number,
+                change_to_add.serializedPayload, endpoint_->getAttributes().topicKind, readerId,
+                expectsInlineQos, inline_qos);
+            }, is_big_submessage);
+        change_to_add.serializedPayload.data = nullptr;
+        return ret_val;
+    }
+
     if (!RTPSMessageCreator::addSubmessageDataFrag(submessage_msg_, &change, fragment_number,
             change_to_add.serializedPayload, endpoint_->getAttributes().topicKind, readerId,
             expectsInlineQos, inline_qos))
@@ -842,7 +923,7 @@ bool RTPSMessageGroup::add_acknack(
 
     // Notify the statistics module, note that only readers add acknacks
     assert(nullptr != dynamic_cast<RTPSReader*>(endpoint_));
-    static_cast<fastdds::statistics::StatisticsReaderImpl*>(static_cast<RTPSReader*>(endpoint_))->on_acknack(count);
+    static_cast<RTPSReader*>(endpoint_)->on_acknack(count);
 
     return insert_submessage(false);
 }
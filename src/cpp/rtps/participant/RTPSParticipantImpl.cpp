@@ -23,6 +23,7 @@
 #include <memory>
 #include <mutex>
 #include <sstream>
+#include <vector>
 
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/attributes/ServerAttributes.h>
@@ -62,6 +63,7 @@
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/persistence/PersistenceService.h>
 #include <statistics/rtps/GuidUtils.hpp>
+#include <utils/StartupPhaseTimer.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -82,6 +84,48 @@ static EntityId_t TrustedWriter(
         c_EntityId_Unknown;
 }
 
+/**
+ * Get the timed events resource shared by the participants of the process that use the given thread settings.
+ * The resource and its thread are created when first requested, and destroyed when the last participant
+ * using them is destroyed.
+ */
+static std::shared_ptr<ResourceEvent> get_shared_event_resource(
+        const fastdds::rtps::ThreadSettings& thread_settings)
+{
+    using SharedEventResource = std::pair<fastdds::rtps::ThreadSettings, std::weak_ptr<ResourceEvent>>;
+
+    static std::mutex shared_event_resources_mutex;
+    static std::vector<SharedEventResource> shared_event_resources;
+
+    std::lock_guard<std::mutex> guard(shared_event_resources_mutex);
+
+    // Drop the resources whose participants have all been destroyed
+    shared_event_resources.erase(
+        std::remove_if(shared_event_resources.begin(), shared_event_resources.end(),
+        [](const SharedEventResource& entry)
+        {
+            return entry.second.expired();
+        }),
+        shared_event_resources.end());
+
+    for (const SharedEventResource& entry : shared_event_resources)
+    {
+        if (entry.first == thread_settings)
+        {
+            std::shared_ptr<ResourceEvent> resource = entry.second.lock();
+            if (resource)
+            {
+                return resource;
+            }
+        }
+    }
+
+    std::shared_ptr<ResourceEvent> resource = std::make_shared<ResourceEvent>();
+    resource->init_thread(thread_settings, "dds.ev.shared");
+    shared_event_resources.emplace_back(thread_settings, resource);
+    return resource;
+}
+
 static bool should_be_intraprocess_only(
         const RTPSParticipantAttributes& att)
 {
@@ -146,6 +190,8 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     , is_intraprocess_only_(should_be_intraprocess_only(PParam))
     , has_shm_transport_(false)
 {
+    StartupPhaseTimer startup_timer(std::string("RTPSParticipant ") + m_att.getName());
+
     if (c_GuidPrefix_Unknown != persistence_guid)
     {
         m_persistence_guid = GUID_t(persistence_guid, c_EntityId_RTPSParticipant);
@@ -156,6 +202,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         UDPv4TransportDescriptor descriptor;
         descriptor.sendBufferSize = m_att.sendSocketBufferSize;
         descriptor.receiveBufferSize = m_att.listenSocketBufferSize;
+        descriptor.default_reception_threads = m_att.builtin_transports_reception_threads;
         if (is_intraprocess_only())
         {
             // Avoid multicast leaving the host for intraprocess-only participants
@@ -174,6 +221,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
             shm_transport.segment_size(segment_size_udp_equivalent);
             // Use same default max_message_size on both UDP and SHM
             shm_transport.max_message_size(descriptor.max_message_size());
+            shm_transport.default_reception_threads = m_att.builtin_transports_reception_threads;
             has_shm_transport_ |= m_network_Factory.RegisterTransport(&shm_transport);
         }
 #endif // ifdef SHM_TRANSPORT_BUILTIN
@@ -239,8 +287,20 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         }
     }
 
+    startup_timer.phase_finished("transports");
+
     mp_userParticipant->mp_impl = this;
-    mp_event_thr.init_thread();
+    const std::string* shared_event_thread =
+            PropertyPolicyHelper::find_property(m_att.properties, "fastdds.shared_timed_events_thread");
+    if (nullptr != shared_event_thread && "true" == *shared_event_thread)
+    {
+        // Timed events are processed by a thread shared with other participants of the process
+        mp_event_thr.init_shared(get_shared_event_resource(m_att.timed_events_thread));
+    }
+    else
+    {
+        mp_event_thr.init_thread(m_att.timed_events_thread, "dds.ev");
+    }
 
     if (!networkFactoryHasRegisteredTransports())
     {
@@ -358,6 +418,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     createReceiverResources(m_att.builtin.metatrafficUnicastLocatorList, true, false);
     createReceiverResources(m_att.defaultUnicastLocatorList, true, false);
     createReceiverResources(m_att.defaultMulticastLocatorList, true, false);
+    startup_timer.phase_finished("receivers");
 
     namespace ExternalLocatorsProcessor = fastdds::rtps::ExternalLocatorsProcessor;
     ExternalLocatorsProcessor::set_listening_locators(m_att.builtin.metatraffic_external_unicast_locators,
@@ -390,7 +451,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
 
     // Initialize flow controller factory.
     // This must be done after initiate network layer.
-    flow_controller_factory_.init(this);
+    flow_controller_factory_.init(this, m_att.builtin_controllers_sender_thread);
 
     // Support old API
     if (PParam.throughputController.bytesPerPeriod != UINT32_MAX && PParam.throughputController.periodMillisecs != 0)
@@ -419,6 +480,8 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 #endif // if HAVE_SECURITY
 
+    startup_timer.phase_finished("send_resources");
+
     mp_builtinProtocols = new BuiltinProtocols();
 
     // Initialize builtin protocols
@@ -427,6 +490,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "The builtin protocols were not correctly initialized");
         return;
     }
+    startup_timer.phase_finished("builtin_protocols");
 
     if (c_GuidPrefix_Unknown != persistence_guid)
     {
@@ -440,6 +504,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
                 "RTPSParticipant \"" << m_att.getName() << "\" with guidPrefix: " << m_guid.guidPrefix);
     }
 
+    startup_timer.report();
     initialized_ = true;
 }
 
@@ -467,7 +532,8 @@ void RTPSParticipantImpl::enable()
 void RTPSParticipantImpl::disable()
 {
     // Disabling event thread also disables participant announcement, so there is no need to call
-    // stopRTPSParticipantAnnouncement()
+    // stopRTPSParticipantAnnouncement(). When the thread is shared with other participants, only the timed events of
+    // this participant are removed from it.
     mp_event_thr.stop_thread();
 
     // Disable Retries on Transports
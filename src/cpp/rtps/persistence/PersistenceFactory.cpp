@@ -30,7 +30,7 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-std::vector<CacheChange_t*>& IPersistenceService::get_changes(
+RingBuffer<CacheChange_t*>& IPersistenceService::get_changes(
         WriterHistory* history)
 {
     return history->m_changes;
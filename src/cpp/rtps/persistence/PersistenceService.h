@@ -24,6 +24,7 @@
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastrtps/utils/collections/RingBuffer.hpp>
 
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
@@ -109,7 +110,7 @@ public:
             const GUID_t& writer_guid,
             const SequenceNumber_t& seq_number) = 0;
 
-    static std::vector<CacheChange_t*>& get_changes(
+    static RingBuffer<CacheChange_t*>& get_changes(
             WriterHistory* history);
 
     static void set_fragments(
@@ -131,6 +131,7 @@ void RTPSReader::init(
                         notification,
                         att.endpoint.data_sharing_configuration().shm_directory(),
                         att.matched_writers_allocation,
+                        mp_RTPSParticipant->getRTPSParticipantAttributes().data_sharing_listener_thread,
                         this));
 
             // We can start the listener here, as no writer can be matched already,
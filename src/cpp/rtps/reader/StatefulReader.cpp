@@ -57,7 +57,7 @@ static void send_ack_if_datasharing(
 
     // This may not be the change read with highest SN,
     // need to find largest SN to ACK
-    for (std::vector<CacheChange_t*>::iterator it = history->changesBegin(); it != history->changesEnd(); ++it)
+    for (History::iterator it = history->changesBegin(); it != history->changesEnd(); ++it)
     {
         if (!(*it)->isRead)
         {
@@ -673,8 +673,25 @@ bool StatefulReader::processDataFragMsg(
             CacheChange_t* change_to_add = incomingChange;
 
             CacheChange_t* change_created = nullptr;
-            CacheChange_t* work_change = nullptr;
-            if (!mp_history->get_change(change_to_add->sequenceNumber, change_to_add->writerGUID, &work_change))
+            CacheChange_t* work_change = pWP->find_fragmented_change(change_to_add->sequenceNumber);
+            if (nullptr == work_change && !pWP->can_add_fragmented_change())
+            {
+                // A change completed by this submessage does not need to be tracked
+                uint32_t fragment_size = change_to_add->getFragmentSize();
+                bool completes_change = 0 < fragment_size && 1 == fragmentStartingNum &&
+                        static_cast<uint64_t>(fragmentsInSubmessage) * fragment_size >= sampleSize;
+                if (!completes_change)
+                {
+                    // Its next fragments could not be found. Ignore this one without marking the change, so it is
+                    // requested again once the reassembly of another change finishes.
+                    EPROSIMA_LOG_INFO(RTPS_MSG_IN,
+                            IDSTRING "Too many fragmented changes in process. Ignoring fragment of " <<
+                            change_to_add->sequenceNumber.to64long());
+                    return false;
+                }
+            }
+
+            if (nullptr == work_change)
             {
                 // A new change should be reserved
                 if (reserveCache(&work_change, sampleSize))
@@ -711,11 +728,20 @@ bool StatefulReader::processDataFragMsg(
                     releaseCache(change_created);
                     work_change = nullptr;
                 }
+                else if (!change_created->is_fully_assembled())
+                {
+                    // Room for it was checked before reserving the change
+                    bool tracked = pWP->add_fragmented_change(change_created);
+                    assert(tracked);
+                    static_cast<void>(tracked);
+                }
             }
 
             // If change has been fully reassembled, mark as received and add notify user
             if (work_change != nullptr && work_change->is_fully_assembled())
             {
+                pWP->remove_fragmented_change(work_change);
+
                 fastdds::dds::SampleRejectedStatusKind rejection_reason;
                 if (mp_history->completed_change(work_change, changes_up_to, rejection_reason))
                 {
@@ -798,7 +824,10 @@ bool StatefulReader::processHeartbeatMsg(
                     hbCount, firstSN, lastSN, finalFlag, livelinessFlag, disable_positive_acks_, assert_liveliness,
                     current_sample_lost))
         {
-            mp_history->remove_fragmented_changes_until(firstSN, writerGUID);
+            if (writer->has_fragmented_changes())
+            {
+                mp_history->remove_fragmented_changes_until(firstSN, writerGUID);
+            }
 
             if (0 < current_sample_lost)
             {
@@ -866,17 +895,7 @@ bool StatefulReader::processGapMsg(
         {
             if (pWP->irrelevant_change_set(auxSN))
             {
-                CacheChange_t* to_remove = nullptr;
-                auto ret_iterator = findCacheInFragmentedProcess(auxSN, pWP->guid(), &to_remove, history_iterator);
-                if (to_remove != nullptr)
-                {
-                    // we called the History version to avoid callbacks
-                    history_iterator = mp_history->History::remove_change_nts(ret_iterator);
-                }
-                else if (ret_iterator != mp_history->changesEnd())
-                {
-                    history_iterator = ret_iterator;
-                }
+                remove_fragmented_change_on_gap(pWP, auxSN, history_iterator);
             }
         }
 
@@ -885,18 +904,7 @@ bool StatefulReader::processGapMsg(
             {
                 if (pWP->irrelevant_change_set(it))
                 {
-                    CacheChange_t* to_remove = nullptr;
-                    auto ret_iterator =
-                    findCacheInFragmentedProcess(auxSN, pWP->guid(), &to_remove, history_iterator);
-                    if (to_remove != nullptr)
-                    {
-                        // we called the History version to avoid callbacks
-                        history_iterator = mp_history->History::remove_change_nts(ret_iterator);
-                    }
-                    else if (ret_iterator != mp_history->changesEnd())
-                    {
-                        history_iterator = ret_iterator;
-                    }
+                    remove_fragmented_change_on_gap(pWP, it, history_iterator);
                 }
             });
 
@@ -909,6 +917,25 @@ bool StatefulReader::processGapMsg(
     return false;
 }
 
+void StatefulReader::remove_fragmented_change_on_gap(
+        WriterProxy* writer,
+        const SequenceNumber_t& seq_num,
+        History::const_iterator& history_iterator)
+{
+    CacheChange_t* to_remove = writer->find_fragmented_change(seq_num);
+    if (nullptr != to_remove)
+    {
+        writer->remove_fragmented_change(to_remove);
+
+        auto ret_iterator = mp_history->get_change_nts(seq_num, writer->guid(), &to_remove, history_iterator);
+        if (nullptr != to_remove)
+        {
+            // we called the History version to avoid callbacks
+            history_iterator = mp_history->History::remove_change_nts(ret_iterator);
+        }
+    }
+}
+
 bool StatefulReader::acceptMsgFrom(
         const GUID_t& writerId,
         WriterProxy** wp) const
@@ -988,6 +1015,7 @@ bool StatefulReader::change_removed_by_history(
                 send_ack_if_datasharing(this, mp_history, proxy, a_change->sequenceNumber);
             }
 
+            proxy->remove_fragmented_change(a_change);
         }
 
         return true;
@@ -1210,7 +1238,7 @@ void StatefulReader::remove_changes_from(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     std::vector<CacheChange_t*> toremove;
-    for (std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    for (History::iterator it = mp_history->changesBegin();
             it != mp_history->changesEnd(); ++it)
     {
         if ((*it)->writerGUID == writerGUID)
@@ -1250,7 +1278,7 @@ bool StatefulReader::nextUntakenCache(
 
     bool takeok = false;
     WriterProxy* wp;
-    std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    History::iterator it = mp_history->changesBegin();
     while (it != mp_history->changesEnd())
     {
         if (this->matched_writer_lookup((*it)->writerGUID, &wp))
@@ -1304,7 +1332,7 @@ bool StatefulReader::nextUnreadCache(
     std::vector<CacheChange_t*> toremove;
     bool readok = false;
     WriterProxy* wp = nullptr;
-    std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    History::iterator it = mp_history->changesBegin();
     while (it != mp_history->changesEnd())
     {
         if ((*it)->isRead)
@@ -1493,20 +1521,13 @@ void StatefulReader::send_acknack(
         RTPSMessageGroup group(getRTPSParticipant(), this, sender);
         if (!missing_changes.empty() || !heartbeat_was_final)
         {
-            GUID_t guid = sender->remote_guids().at(0);
             SequenceNumberSet_t sns(writer->available_changes_max() + 1);
-            History::const_iterator history_iterator = mp_history->changesBegin();
 
             missing_changes.for_each(
                 [&](const SequenceNumber_t& seq)
                 {
                     // Check if the CacheChange_t is uncompleted.
-                    CacheChange_t* uncomplete_change = nullptr;
-                    auto ret_iterator = findCacheInFragmentedProcess(seq, guid, &uncomplete_change, history_iterator);
-                    if (ret_iterator != mp_history->changesEnd())
-                    {
-                        history_iterator = ret_iterator;
-                    }
+                    CacheChange_t* uncomplete_change = writer->find_fragmented_change(seq);
                     if (uncomplete_change == nullptr)
                     {
                         if (!sns.add(seq))
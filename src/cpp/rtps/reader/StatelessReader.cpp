@@ -348,7 +348,7 @@ void StatelessReader::remove_changes_from(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     std::vector<CacheChange_t*> toremove;
-    for (std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    for (History::iterator it = mp_history->changesBegin();
             it != mp_history->changesEnd(); ++it)
     {
         if ((*it)->writerGUID == writerGUID)
@@ -385,7 +385,7 @@ bool StatelessReader::nextUnreadCache(
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     bool found = false;
-    std::vector<CacheChange_t*>::iterator it = mp_history->changesBegin();
+    History::iterator it = mp_history->changesBegin();
     while (it != mp_history->changesEnd())
     {
         if ((*it)->isRead)
@@ -82,6 +82,7 @@ WriterProxy::WriterProxy(
         set_helper::node_size,
         set_helper::min_pool_size<pool_allocator_t>(changes_allocation.initial))
     , changes_received_(changes_pool_)
+    , fragmented_changes_(changes_allocation)
     , guid_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , guid_prefix_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , is_on_same_process_(false)
@@ -198,6 +199,7 @@ void WriterProxy::clear()
     guid_as_vector_.clear();
     guid_prefix_as_vector_.clear();
     changes_received_.clear();
+    fragmented_changes_.clear();
     is_on_same_process_ = false;
     loaded_from_storage(SequenceNumber_t());
 }
@@ -385,6 +387,76 @@ bool WriterProxy::change_was_received(
     return chit != changes_received_.end();
 }
 
+CacheChange_t* WriterProxy::find_fragmented_change(
+        const SequenceNumber_t& seq_num) const
+{
+#ifdef SHOULD_DEBUG_LINUX
+    assert(get_mutex_owner() == get_thread_id());
+#endif // SHOULD_DEBUG_LINUX
+
+    auto it = std::lower_bound(fragmented_changes_.begin(), fragmented_changes_.end(), seq_num,
+                    [](const CacheChange_t* change, const SequenceNumber_t& sn)
+                    {
+                        return change->sequenceNumber < sn;
+                    });
+
+    if (it != fragmented_changes_.end() && (*it)->sequenceNumber == seq_num)
+    {
+        return *it;
+    }
+
+    return nullptr;
+}
+
+bool WriterProxy::add_fragmented_change(
+        CacheChange_t* change)
+{
+#ifdef SHOULD_DEBUG_LINUX
+    assert(get_mutex_owner() == get_thread_id());
+#endif // SHOULD_DEBUG_LINUX
+
+    assert(nullptr != change);
+    assert(!change->is_fully_assembled());
+
+    // Fragments are usually received in order, so the common case is appending at the end.
+    auto it = fragmented_changes_.end();
+    if (!fragmented_changes_.empty() && change->sequenceNumber < fragmented_changes_.back()->sequenceNumber)
+    {
+        it = std::lower_bound(fragmented_changes_.begin(), fragmented_changes_.end(), change->sequenceNumber,
+                        [](const CacheChange_t* item, const SequenceNumber_t& sn)
+                        {
+                            return item->sequenceNumber < sn;
+                        });
+    }
+
+    if (fragmented_changes_.end() == fragmented_changes_.insert(it, change))
+    {
+        EPROSIMA_LOG_WARNING(RTPS_READER, "Cannot keep track of fragmented change " << change->sequenceNumber);
+        return false;
+    }
+
+    return true;
+}
+
+void WriterProxy::remove_fragmented_change(
+        const CacheChange_t* change)
+{
+#ifdef SHOULD_DEBUG_LINUX
+    assert(get_mutex_owner() == get_thread_id());
+#endif // SHOULD_DEBUG_LINUX
+
+    auto it = std::lower_bound(fragmented_changes_.begin(), fragmented_changes_.end(), change->sequenceNumber,
+                    [](const CacheChange_t* item, const SequenceNumber_t& sn)
+                    {
+                        return item->sequenceNumber < sn;
+                    });
+
+    if (it != fragmented_changes_.end() && *it == change)
+    {
+        fragmented_changes_.erase(it);
+    }
+}
+
 const SequenceNumber_t WriterProxy::available_changes_max() const
 {
 #ifdef SHOULD_DEBUG_LINUX
@@ -231,6 +231,50 @@ public:
     bool change_was_received(
             const SequenceNumber_t& seq_num) const;
 
+    /**
+     * Get the change of this writer whose reassembly is in process.
+     * @param[in] seq_num Sequence number of the fragmented change to look for.
+     * @return Pointer to the not fully assembled change, or nullptr when there is none.
+     */
+    CacheChange_t* find_fragmented_change(
+            const SequenceNumber_t& seq_num) const;
+
+    /**
+     * Register a change of this writer whose reassembly has started.
+     * The change should be present on the reader's history.
+     * @param[in] change Not fully assembled change to register.
+     * @return false when the limit of tracked changes has been reached, in which case the change is not registered.
+     * Callers should check @ref can_add_fragmented_change before adding the change to the history.
+     */
+    bool add_fragmented_change(
+            CacheChange_t* change);
+
+    /**
+     * Check whether a new change of this writer can be registered as being reassembled.
+     * @return true when the limit of tracked changes has not been reached.
+     */
+    bool can_add_fragmented_change() const
+    {
+        return fragmented_changes_.size() < fragmented_changes_.max_size();
+    }
+
+    /**
+     * Unregister a change of this writer whose reassembly is in process.
+     * Should be called when the change is fully assembled or removed from the reader's history.
+     * @param[in] change Change to unregister.
+     */
+    void remove_fragmented_change(
+            const CacheChange_t* change);
+
+    /**
+     * Check whether there are changes of this writer whose reassembly is in process.
+     * @return true when at least one fragmented change is being reassembled.
+     */
+    bool has_fragmented_changes() const
+    {
+        return !fragmented_changes_.empty();
+    }
+
     /**
      * Sends a preemptive acknack to the writer represented by this proxy.
      */
@@ -391,6 +435,8 @@ private:
     pool_allocator_t changes_pool_;
     //! Vector containing the sequence number of the received ChangeFromWriter_t objects.
     foonathan::memory::set<SequenceNumber_t, pool_allocator_t> changes_received_;
+    //! Changes being reassembled, ordered by sequence number.
+    ResourceLimitedVector<CacheChange_t*> fragmented_changes_;
     //! Sequence number of the highest available change
     SequenceNumber_t changes_from_writer_low_mark_;
     //! Highest sequence number informed by writer
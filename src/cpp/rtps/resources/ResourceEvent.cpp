@@ -20,6 +20,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include "TimedEventImpl.h"
+#include <utils/threading.hpp>
 
 #include <cassert>
 #include <thread>
@@ -44,9 +45,35 @@ ResourceEvent::~ResourceEvent()
     stop_thread();
 }
 
+void ResourceEvent::init_shared(
+        std::shared_ptr<ResourceEvent> service)
+{
+    std::lock_guard<TimedMutex> guard(mutex_);
+    stop_.store(false);
+    shared_service_ = std::move(service);
+}
+
 void ResourceEvent::stop_thread()
 {
     EPROSIMA_LOG_INFO(RTPS_PARTICIPANT, "Removing event thread");
+    if (shared_service_)
+    {
+        std::vector<TimedEventImpl*> timers;
+        {
+            std::lock_guard<TimedMutex> guard(mutex_);
+            stop_.store(true);
+            timers.swap(shared_timers_);
+        }
+
+        // The shared thread keeps running for its other users, so only the timers of this object are removed from it.
+        // This is done without holding mutex_, as unregister_timer() waits for any running callback to finish.
+        for (TimedEventImpl* event : timers)
+        {
+            shared_service_->unregister_timer(event);
+        }
+        return;
+    }
+
     if (thread_.joinable())
     {
         {
@@ -59,8 +86,20 @@ void ResourceEvent::stop_thread()
 }
 
 void ResourceEvent::register_timer(
-        TimedEventImpl* /*event*/)
+        TimedEventImpl* event)
 {
+    if (shared_service_)
+    {
+        std::lock_guard<TimedMutex> lock(mutex_);
+        ++timers_count_;
+        if (!stop_.load())
+        {
+            shared_timers_.push_back(event);
+            shared_service_->register_timer(event);
+        }
+        return;
+    }
+
     {
         std::lock_guard<TimedMutex> lock(mutex_);
         ++timers_count_;
@@ -73,6 +112,27 @@ void ResourceEvent::register_timer(
 void ResourceEvent::unregister_timer(
         TimedEventImpl* event)
 {
+    if (shared_service_)
+    {
+        bool is_registered = false;
+        {
+            std::lock_guard<TimedMutex> lock(mutex_);
+            auto it = std::find(shared_timers_.begin(), shared_timers_.end(), event);
+            if (it != shared_timers_.end())
+            {
+                shared_timers_.erase(it);
+                is_registered = true;
+            }
+            --timers_count_;
+        }
+
+        if (is_registered)
+        {
+            shared_service_->unregister_timer(event);
+        }
+        return;
+    }
+
     std::unique_lock<TimedMutex> lock(mutex_);
 
     bool is_service_thread = std::this_thread::get_id() == thread_.get_id();
@@ -128,6 +188,16 @@ void ResourceEvent::notify(
 {
     std::lock_guard<TimedMutex> lock(mutex_);
 
+    if (shared_service_)
+    {
+        // Timers of a stopped object are no longer registered on the shared one
+        if (!stop_.load())
+        {
+            shared_service_->notify(event);
+        }
+        return;
+    }
+
     if (register_timer_nts(event))
     {
         // Notify the execution thread that something changed
@@ -147,6 +217,15 @@ void ResourceEvent::notify(
     std::lock_guard<TimedMutex> _(mutex_);
 #endif  // HAVE_STRICT_REALTIME
     {
+        if (shared_service_)
+        {
+            if (!stop_.load())
+            {
+                shared_service_->notify(event, timeout);
+            }
+            return;
+        }
+
         if (register_timer_nts(event))
         {
             // Notify the execution thread that something changed
@@ -303,7 +382,9 @@ void ResourceEvent::do_timer_actions()
     }
 }
 
-void ResourceEvent::init_thread()
+void ResourceEvent::init_thread(
+        const fastdds::rtps::ThreadSettings& settings,
+        const char* name)
 {
     std::lock_guard<TimedMutex> lock(mutex_);
 
@@ -311,7 +392,11 @@ void ResourceEvent::init_thread()
     stop_.store(false);
     resize_collections();
 
-    thread_ = std::thread(&ResourceEvent::event_service, this);
+    thread_ = std::thread([this, settings, name]()
+                    {
+                        configure_current_thread(settings, name, 0);
+                        event_service();
+                    });
 }
 
 } /* namespace rtps */
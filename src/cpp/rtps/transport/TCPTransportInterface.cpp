@@ -34,6 +34,7 @@
 #endif // if TLS_FOUND
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 #include <utils/SystemInfo.hpp>
+#include <utils/threading.hpp>
 
 using namespace std;
 using namespace asio;
@@ -418,6 +419,7 @@ bool TCPTransportInterface::init(
 
     auto ioServiceFunction = [&]()
             {
+                configure_current_thread(configuration()->default_reception_threads, "dds.tcp_accept", 0);
 #if ASIO_VERSION >= 101200
                 asio::executor_work_guard<asio::io_service::executor_type> work(io_service_.get_executor());
 #else
@@ -798,6 +800,12 @@ void TCPTransportInterface::perform_listen_operation(
     std::shared_ptr<TCPChannelResource> channel;
     rtcp_message_manager = rtcp_manager.lock();
 
+    {
+        auto channel_for_name = channel_weak.lock();
+        uint32_t port = channel_for_name ? channel_for_name->locator().port : 0;
+        configure_current_thread(configuration()->default_reception_threads, "dds.tcp.%u", port);
+    }
+
     // RTCP Control Message
     if (rtcp_message_manager)
     {
@@ -17,6 +17,7 @@
 #include <asio.hpp>
 #include <fastdds/rtps/messages/MessageReceiver.h>
 #include <rtps/transport/UDPTransportInterface.h>
+#include <utils/threading.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -31,7 +32,8 @@ UDPChannelResource::UDPChannelResource(
         uint32_t maxMsgSize,
         const Locator& locator,
         const std::string& sInterface,
-        TransportReceiverInterface* receiver)
+        TransportReceiverInterface* receiver,
+        const ThreadSettings& thread_config)
     : ChannelResource(maxMsgSize)
     , message_receiver_(receiver)
     , socket_(moveSocket(socket))
@@ -39,7 +41,12 @@ UDPChannelResource::UDPChannelResource(
     , interface_(sInterface)
     , transport_(transport)
 {
-    thread(std::thread(&UDPChannelResource::perform_listen_operation, this, locator));
+    auto fn = [this, locator, thread_config]()
+            {
+                configure_current_thread(thread_config, "dds.udp.%u", locator.port);
+                perform_listen_operation(locator);
+            };
+    thread(std::thread(fn));
 }
 
 UDPChannelResource::~UDPChannelResource()
@@ -15,12 +15,14 @@
 #ifndef _FASTDDS_SHAREDMEM_CHANNEL_RESOURCE_
 #define _FASTDDS_SHAREDMEM_CHANNEL_RESOURCE_
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/messages/MessageReceiver.h>
 #include <fastrtps/rtps/common/Locator.h>
 
 #include <rtps/transport/shared_mem/SharedMemManager.hpp>
 #include <rtps/transport/shared_mem/SharedMemTransport.h>
 #include <rtps/transport/ChannelResource.h>
+#include <utils/threading.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -37,6 +39,7 @@ public:
             const Locator& locator,
             TransportReceiverInterface* receiver,
             const std::string& dump_file,
+            const ThreadSettings& thread_config,
             bool should_init_thread = true)
         : ChannelResource()
         , message_receiver_(receiver)
@@ -55,7 +58,7 @@ public:
 
         if (should_init_thread)
         {
-            init_thread(locator);
+            init_thread(locator, thread_config);
         }
     }
 
@@ -164,9 +167,15 @@ private:
 protected:
 
     void init_thread(
-            const Locator& locator)
+            const Locator& locator,
+            const ThreadSettings& thread_config)
     {
-        this->thread(std::thread(&SharedMemChannelResource::perform_listen_operation, this, locator));
+        auto fn = [this, locator, thread_config]()
+                {
+                    configure_current_thread(thread_config, "dds.shm.%u", locator.port);
+                    perform_listen_operation(locator);
+                };
+        this->thread(std::thread(fn));
     }
 
     /**
@@ -16,9 +16,15 @@
 #define _FASTDDS_SHAREDMEM_MANAGER_H_
 
 #include <atomic>
+#include <chrono>
 #include <list>
+#include <thread>
 #include <unordered_map>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif // if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
 #include <rtps/transport/shared_mem/SharedMemGlobal.hpp>
 
 #include <utils/shared_memory/RobustSharedLock.hpp>
@@ -667,6 +673,21 @@ public:
             }
         }
 
+        /**
+         * Configure the adaptive wait done by pop() before blocking on the port.
+         * While spinning or yielding the listener is not registered as waiting in the port, so writers
+         * do not notify it.
+         * @param spin_time_us Time busy-waiting for a new descriptor (us).
+         * @param yield_time_us Time yielding the CPU waiting for a new descriptor, after spinning (us).
+         */
+        void wait_policy(
+                uint32_t spin_time_us,
+                uint32_t yield_time_us)
+        {
+            spin_time_ = std::chrono::microseconds(spin_time_us);
+            yield_time_ = std::chrono::microseconds(yield_time_us);
+        }
+
         Listener& operator = (
                 Listener&& other)
         {
@@ -702,6 +723,8 @@ public:
                     SharedMemGlobal::PortCell* head_cell = nullptr;
                     buffer_ref.reset();
 
+                    spin_wait();
+
                     while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
                     {
                         // Wait until there's data to pop
@@ -777,6 +800,34 @@ public:
             return buffer_ref;
         }
 
+        /**
+         * Busy-wait, and then yield, until there is data to pop or the configured times elapse.
+         */
+        void spin_wait()
+        {
+            if (spin_time_.count() == 0 && yield_time_.count() == 0)
+            {
+                return;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            auto spin_deadline = now + spin_time_;
+            auto yield_deadline = spin_deadline + yield_time_;
+
+            while (!is_closed_.load() && nullptr == global_listener_->head() && now < yield_deadline)
+            {
+                if (now < spin_deadline)
+                {
+                    cpu_relax();
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+                now = std::chrono::steady_clock::now();
+            }
+        }
+
         void stop_processing_buffer()
         {
             global_port_->listener_processing_stop(listener_index_);
@@ -803,6 +854,18 @@ public:
 
     private:
 
+        //! Hint the CPU that the caller is busy-waiting
+        static inline void cpu_relax()
+        {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+            asm volatile ("yield");
+#endif // if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        }
+
         std::shared_ptr<SharedMemGlobal::Port> global_port_;
 
         std::unique_ptr<SharedMemGlobal::Listener> global_listener_;
@@ -812,6 +875,10 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        std::chrono::microseconds spin_time_{0};
+
+        std::chrono::microseconds yield_time_{0};
+
     }; // Listener
 
     /**
@@ -328,15 +328,19 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
     auto open_mode = locator.address[0] == 'M' ? SharedMemGlobal::Port::OpenMode::ReadShared :
             SharedMemGlobal::Port::OpenMode::ReadExclusive;
 
+    auto listener = shared_mem_manager_->open_port(
+        locator.port,
+        configuration_.port_queue_capacity(),
+        configuration_.healthy_check_timeout_ms(),
+        open_mode)->create_listener();
+    listener->wait_policy(configuration_.wait_spin_time_us(), configuration_.wait_yield_time_us());
+
     return new SharedMemChannelResource(
-        shared_mem_manager_->open_port(
-            locator.port,
-            configuration_.port_queue_capacity(),
-            configuration_.healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+        listener,
         locator,
         receiver,
-        configuration_.rtps_dump_file());
+        configuration_.rtps_dump_file(),
+        configuration_.default_reception_threads);
 }
 
 bool SharedMemTransport::OpenOutputChannel(
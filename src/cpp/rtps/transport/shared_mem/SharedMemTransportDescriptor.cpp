@@ -38,6 +38,8 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
     , rtps_dump_file_("")
+    , wait_spin_time_us_(0)
+    , wait_yield_time_us_(0)
 {
     maxMessageSize = s_maximumMessageSize;
 }
@@ -49,6 +51,8 @@ bool SharedMemTransportDescriptor::operator ==(
            this->port_queue_capacity_ == t.port_queue_capacity() &&
            this->healthy_check_timeout_ms_ == t.healthy_check_timeout_ms() &&
            this->rtps_dump_file_ == t.rtps_dump_file() &&
+           this->wait_spin_time_us_ == t.wait_spin_time_us() &&
+           this->wait_yield_time_us_ == t.wait_yield_time_us() &&
            TransportDescriptorInterface::operator ==(t));
 }
 
@@ -32,12 +32,13 @@ public:
             const Locator& locator,
             TransportReceiverInterface* receiver,
             uint32_t big_buffer_size,
-            uint32_t* big_buffer_size_count)
-        : SharedMemChannelResource(listener, locator, receiver, std::string(), false)
+            uint32_t* big_buffer_size_count,
+            const ThreadSettings& thread_config)
+        : SharedMemChannelResource(listener, locator, receiver, std::string(), thread_config, false)
         , big_buffer_size_(big_buffer_size)
         , big_buffer_size_count_(big_buffer_size_count)
     {
-        init_thread(locator);
+        init_thread(locator, thread_config);
     }
 
     virtual ~test_SharedMemChannelResource() override
@@ -75,16 +75,20 @@ SharedMemChannelResource* test_SharedMemTransport::CreateInputChannelResource(
     auto open_mode = locator.address[0] == 'M' ? SharedMemGlobal::Port::OpenMode::ReadShared :
             SharedMemGlobal::Port::OpenMode::ReadExclusive;
 
+    auto listener = shared_mem_manager_->open_port(
+        locator.port,
+        configuration()->port_queue_capacity(),
+        configuration()->healthy_check_timeout_ms(),
+        open_mode)->create_listener();
+    listener->wait_policy(configuration()->wait_spin_time_us(), configuration()->wait_yield_time_us());
+
     return new test_SharedMemChannelResource(
-        shared_mem_manager_->open_port(
-            locator.port,
-            configuration()->port_queue_capacity(),
-            configuration()->healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+        listener,
         locator,
         receiver,
         big_buffer_size_,
-        big_buffer_size_recv_count_);
+        big_buffer_size_recv_count_,
+        configuration()->default_reception_threads);
 }
 
 }  // namespace rtps
@@ -2,6 +2,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <algorithm>
+#include <functional>
 
 using namespace std::chrono;
 
@@ -9,8 +10,6 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-using LivelinessDataIterator = ResourceLimitedVector<LivelinessData>::iterator;
-
 LivelinessManager::LivelinessManager(
         const LivelinessCallback& callback,
         ResourceEvent& service,
@@ -55,17 +54,19 @@ bool LivelinessManager::add_writer(
         // writers_ elements guard
         std::lock_guard<std::mutex> __(mutex_);
 
-        for (LivelinessData& writer : writers_)
+        size_t index = find_writer(guid, kind, lease_duration);
+        if (index < writers_.size())
         {
-            if (writer.guid == guid &&
-                    writer.kind == kind &&
-                    writer.lease_duration == lease_duration)
-            {
-                writer.count++;
-                return true;
-            }
+            writers_[index].count++;
+            return true;
+        }
+        if (nullptr != writers_.emplace_back(guid, kind, lease_duration))
+        {
+            writers_index_.emplace(guid, writers_.size() - 1);
         }
-        writers_.emplace_back(guid, kind, lease_duration);
+
+        // The collection may have been reallocated
+        calculate_next_nts();
     }
 
     if (!calculate_next())
@@ -103,14 +104,46 @@ bool LivelinessManager::remove_writer(
         // writers_ elements guard
         std::lock_guard<std::mutex> __(mutex_);
 
-        removed = writers_.remove_if([guid, kind, lease_duration, &status](LivelinessData& writer)
-                        {
-                            status = writer.status;
-                            return writer.guid == guid &&
-                            writer.kind == kind &&
-                            writer.lease_duration == lease_duration &&
-                            --writer.count == 0;
-                        });
+        size_t index = find_writer(guid, kind, lease_duration);
+        if (index < writers_.size() && --writers_[index].count == 0)
+        {
+            status = writers_[index].status;
+
+            auto range = writers_index_.equal_range(guid);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == index)
+                {
+                    writers_index_.erase(it);
+                    break;
+                }
+            }
+
+            // Move the last writer to the freed position
+            size_t last = writers_.size() - 1;
+            if (index != last)
+            {
+                range = writers_index_.equal_range(writers_[last].guid);
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (it->second == last)
+                    {
+                        it->second = index;
+                        break;
+                    }
+                }
+                writers_[index] = std::move(writers_[last]);
+                if (writers_[index].status == LivelinessData::WriterStatus::ALIVE)
+                {
+                    push_deadline(index);
+                }
+            }
+            writers_.pop_back();
+            removed = true;
+
+            // The timer owner may have been removed or moved
+            calculate_next_nts();
+        }
     }
 
     if (!removed)
@@ -130,28 +163,21 @@ bool LivelinessManager::remove_writer(
         }
     }
 
-    std::unique_lock<std::mutex> lock(mutex_);
-
-    if (timer_owner_ != nullptr)
+    if (!calculate_next())
     {
-        lock.unlock();
-
-        if (!calculate_next())
-        {
-            timer_.cancel_timer();
-            return true;
-        }
+        timer_.cancel_timer();
+        return true;
+    }
 
-        lock.lock();
+    std::lock_guard<std::mutex> lock(mutex_);
 
-        if (timer_owner_ != nullptr)
-        {
-            // Some times the interval could be negative if a writer expired during the call to this function
-            // Once in this situation there is not much we can do but let asio timers expire inmediately
-            auto interval = timer_owner_->time - steady_clock::now();
-            timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-            timer_.restart_timer();
-        }
+    if (timer_owner_ != nullptr)
+    {
+        // Some times the interval could be negative if a writer expired during the call to this function
+        // Once in this situation there is not much we can do but let asio timers expire inmediately
+        auto interval = timer_owner_->time - steady_clock::now();
+        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
+        timer_.restart_timer();
     }
 
     return true;
@@ -163,42 +189,38 @@ bool LivelinessManager::assert_liveliness(
         Duration_t lease_duration)
 {
     bool found = false;
+    bool reschedule = true;
 
     {
         // collection guard
         shared_lock<shared_mutex> _(col_mutex_);
 
-        for (LivelinessData& writer : writers_)
+        size_t index = find_writer(guid, kind, lease_duration);
+        if (index < writers_.size())
         {
-            // writers_ elements guard
-            std::unique_lock<std::mutex> lock(mutex_);
+            found = true;
+            LivelinessData& writer = writers_[index];
 
-            if (writer.guid == guid &&
-                    writer.kind == kind &&
-                    writer.lease_duration == lease_duration)
+            // Execute the callbacks
+            if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
+                    writer.kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
             {
-                lock.unlock();
-
-                found = true;
-
-                // Execute the callbacks
-                if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
-                        writer.kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+                for (LivelinessData& w: writers_)
                 {
-                    for (LivelinessData& w: writers_)
+                    if (w.kind == writer.kind)
                     {
-                        if (w.kind == writer.kind)
-                        {
-                            assert_writer_liveliness(w);
-                        }
+                        assert_writer_liveliness(w);
                     }
                 }
-                else if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
-                {
-                    assert_writer_liveliness(writer);
-                }
+            }
+            else if (writer.kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+            {
+                assert_writer_liveliness(writer);
 
-                break;
+                // The next deadline only changes if this writer owned it, or if it now expires before it
+                std::lock_guard<std::mutex> lock(mutex_);
+                reschedule = timer_owner_ == nullptr || timer_owner_ == &writer ||
+                        writer.time < timer_owner_->time;
             }
         }
     }
@@ -208,6 +230,11 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
+    if (!reschedule)
+    {
+        return true;
+    }
+
     timer_.cancel_timer();
 
     // Updates the timer owner
@@ -291,26 +318,29 @@ bool LivelinessManager::calculate_next()
     shared_lock<shared_mutex> _(col_mutex_);
     std::lock_guard<std::mutex> __(mutex_);
 
-    bool any_alive = false;
-    steady_clock::time_point min_time = steady_clock::now() + nanoseconds(c_TimeInfinite.to_ns());
+    return calculate_next_nts();
+}
 
+bool LivelinessManager::calculate_next_nts()
+{
     timer_owner_ = nullptr;
 
-    // collection guard
-    for (LivelinessData& writer : writers_)
+    // Discard the entries of writers that were asserted again, lost their liveliness or were removed
+    while (!deadlines_.empty())
     {
-        if (writer.status == LivelinessData::WriterStatus::ALIVE)
+        const Deadline& next = deadlines_.front();
+        if (next.index < writers_.size() &&
+                writers_[next.index].status == LivelinessData::WriterStatus::ALIVE &&
+                writers_[next.index].time == next.time)
         {
-            if (writer.time < min_time)
-            {
-                min_time = writer.time;
-                timer_owner_ = &writer;
-            }
-            any_alive = true;
+            timer_owner_ = &writers_[next.index];
+            return true;
         }
+        std::pop_heap(deadlines_.begin(), deadlines_.end(), std::greater<Deadline>());
+        deadlines_.pop_back();
     }
 
-    return any_alive;
+    return false;
 }
 
 bool LivelinessManager::timer_expired()
@@ -387,6 +417,7 @@ void LivelinessManager::assert_writer_liveliness(
 
     writer.status = LivelinessData::WriterStatus::ALIVE;
     writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
+    push_deadline(static_cast<size_t>(&writer - &writers_[0]));
 
     lock.unlock();
 
@@ -403,6 +434,45 @@ void LivelinessManager::assert_writer_liveliness(
     }
 }
 
+size_t LivelinessManager::find_writer(
+        const GUID_t& guid,
+        LivelinessQosPolicyKind kind,
+        const Duration_t& lease_duration) const
+{
+    auto range = writers_index_.equal_range(guid);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const LivelinessData& writer = writers_[it->second];
+        if (writer.kind == kind && writer.lease_duration == lease_duration)
+        {
+            return it->second;
+        }
+    }
+
+    return writers_.size();
+}
+
+void LivelinessManager::push_deadline(
+        size_t index)
+{
+    // Rebuild the heap when it is mostly made of outdated entries
+    if (deadlines_.size() > 2 * writers_.size() + 16)
+    {
+        deadlines_.clear();
+        for (size_t i = 0; i < writers_.size(); ++i)
+        {
+            if (writers_[i].status == LivelinessData::WriterStatus::ALIVE && i != index)
+            {
+                deadlines_.push_back({writers_[i].time, i});
+            }
+        }
+        std::make_heap(deadlines_.begin(), deadlines_.end(), std::greater<Deadline>());
+    }
+
+    deadlines_.push_back({writers_[index].time, index});
+    std::push_heap(deadlines_.begin(), deadlines_.end(), std::greater<Deadline>());
+}
+
 const ResourceLimitedVector<LivelinessData>& LivelinessManager::get_liveliness_data() const
 {
     return writers_;
@@ -138,6 +138,9 @@ RTPSWriter::~RTPSWriter()
 {
     EPROSIMA_LOG_INFO(RTPS_WRITER, "RTPSWriter destructor");
 
+    // Sample batches are always ended before releasing the writer mutex
+    assert(nullptr == sample_batch_group_);
+
     // Deletion of the events has to be made in child destructor.
     // Also at this point all CacheChange_t must have been released by the child destructor
 
@@ -441,6 +444,59 @@ bool RTPSWriter::send_nts(
                    locator_selector.locator_selector.end(), max_blocking_time_point);
 }
 
+bool RTPSWriter::begin_sample_batch_nts(
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    // A batch waiting for history space releases the mutex, so another thread may try to open one meanwhile
+    if (is_async_ || nullptr != sample_batch_group_)
+    {
+        return false;
+    }
+
+    sample_batch_group_ = new RTPSMessageGroup(mp_RTPSParticipant, this, &get_general_locator_selector(),
+                    max_blocking_time);
+    sample_batch_owner_ = std::this_thread::get_id();
+    return true;
+}
+
+void RTPSWriter::end_sample_batch_nts()
+{
+    if (nullptr != sample_batch_group_)
+    {
+        assert(std::this_thread::get_id() == sample_batch_owner_);
+        RTPSMessageGroup* group = sample_batch_group_;
+        sample_batch_group_ = nullptr;
+        sample_batch_owner_ = std::thread::id();
+
+        std::lock_guard<LocatorSelectorSender> lock(get_general_locator_selector());
+        try
+        {
+            // Destroying the group sends the pending submessages
+            delete group;
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+        }
+    }
+}
+
+void RTPSWriter::flush_sample_batch_nts()
+{
+    if (nullptr != sample_batch_group_)
+    {
+        std::lock_guard<LocatorSelectorSender> lock(get_general_locator_selector());
+        try
+        {
+            sample_batch_group_->flush_and_reset();
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER, "Max blocking time reached");
+        }
+    }
+}
+
 #ifdef FASTDDS_STATISTICS
 
 bool RTPSWriter::add_statistics_listener(
@@ -40,6 +40,37 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/*
+ * Layout of the state kept for each sequence number on the window of a ReaderProxy.
+ * The lower bits hold the ChangeForReaderStatus_t of the change.
+ */
+static constexpr uint8_t change_status_mask = 0x07;
+//! The change is relevant for the reader, i.e. it is being tracked.
+static constexpr uint8_t change_relevant_flag = 0x08;
+//! The change was delivered at least once.
+static constexpr uint8_t change_delivered_flag = 0x10;
+//! The change is fragmented. Its fragmentation state is kept on fragmented_changes_.
+static constexpr uint8_t change_fragmented_flag = 0x20;
+
+static inline ChangeForReaderStatus_t change_status(
+        uint8_t state)
+{
+    return static_cast<ChangeForReaderStatus_t>(state & change_status_mask);
+}
+
+static bool change_less_than_sequence(
+        const ChangeForReader_t& change,
+        const SequenceNumber_t& seq_num)
+{
+    return change.getSequenceNumber() < seq_num;
+}
+
+static inline bool change_is_fragmented(
+        const CacheChange_t* change)
+{
+    return nullptr != change && 0 != change->getFragmentSize();
+}
+
 ReaderProxy::ReaderProxy(
         const WriterTimes& times,
         const RemoteLocatorsAllocationAttributes& loc_alloc,
@@ -53,13 +84,16 @@ ReaderProxy::ReaderProxy(
     , is_reliable_(false)
     , disable_positive_acks_(false)
     , writer_(writer)
-    , changes_for_reader_(resource_limits_from_history(writer->mp_history->m_att, 0))
+    , fragmented_changes_(resource_limits_from_history(writer->mp_history->m_att, 0))
     , nack_supression_event_(nullptr)
     , initial_heartbeat_event_(nullptr)
     , timers_enabled_(false)
     , last_acknack_count_(0)
     , last_nackfrag_count_(0)
 {
+    changes_window_.reserve(resource_limits_from_history(writer->mp_history->m_att, 0).initial);
+    changes_per_status_.fill(0);
+
     nack_supression_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(),
                     [&]() -> bool
                     {
@@ -165,7 +199,10 @@ void ReaderProxy::stop()
     is_active_ = false;
     disable_timers();
 
-    changes_for_reader_.clear();
+    changes_window_.clear();
+    changes_window_base_ = SequenceNumber_t();
+    changes_per_status_.fill(0);
+    fragmented_changes_.clear();
     last_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
@@ -218,8 +255,8 @@ void ReaderProxy::add_change(
         bool is_relevant)
 {
     assert(change.getSequenceNumber() > changes_low_mark_);
-    assert(changes_for_reader_.empty() ? true :
-            change.getSequenceNumber() > changes_for_reader_.back().getSequenceNumber());
+    assert(changes_window_.empty() ? true :
+            change.getSequenceNumber() >= changes_window_base_ + static_cast<uint32_t>(changes_window_.size()));
 
     // Irrelevant changes are not added to the collection
     if (!is_relevant)
@@ -232,38 +269,60 @@ void ReaderProxy::add_change(
         return;
     }
 
-    if (changes_for_reader_.push_back(change) == nullptr)
+    uint8_t state = change_relevant_flag | change.getStatus();
+    if (change.has_been_delivered())
     {
-        // This should never happen
-        EPROSIMA_LOG_ERROR(RTPS_READER_PROXY, "Error adding change " << change.getSequenceNumber()
-                                                                     << " to reader proxy " << guid());
-        eprosima::fastdds::dds::Log::Flush();
-        assert(false);
+        state |= change_delivered_flag;
+    }
+
+    if (change_is_fragmented(change.getChange()))
+    {
+        if (fragmented_changes_.push_back(change) == nullptr)
+        {
+            // This should never happen
+            EPROSIMA_LOG_ERROR(RTPS_READER_PROXY, "Error adding change " << change.getSequenceNumber()
+                                                                         << " to reader proxy " << guid());
+            eprosima::fastdds::dds::Log::Flush();
+            assert(false);
+            return;
+        }
+        state |= change_fragmented_flag;
     }
+
+    window_entry(change.getSequenceNumber()) = state;
+    ++changes_per_status_[change.getStatus()];
 }
 
 bool ReaderProxy::has_changes() const
 {
-    return !changes_for_reader_.empty();
+    for (uint32_t count : changes_per_status_)
+    {
+        if (0 < count)
+        {
+            return true;
+        }
+    }
+
+    return false;
 }
 
 bool ReaderProxy::change_is_acked(
         const SequenceNumber_t& seq_num) const
 {
-    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    if (seq_num <= changes_low_mark_)
     {
         return true;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    const uint8_t* state = find_change_state(seq_num);
+    if (nullptr == state)
     {
-        // There is a hole in changes_for_reader_
+        // There is a hole in the window
         // This means a change was removed, or was not relevant.
         return true;
     }
 
-    return chit->getStatus() == ACKNOWLEDGED;
+    return change_status(*state) == ACKNOWLEDGED;
 }
 
 bool ReaderProxy::change_is_unsent(
@@ -273,36 +332,50 @@ bool ReaderProxy::change_is_unsent(
         const SequenceNumber_t& min_seq,
         bool& need_reactivate_periodic_heartbeat) const
 {
-    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    if (seq_num <= changes_low_mark_)
     {
         return false;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    const uint8_t* state = find_change_state(seq_num);
+    if (nullptr == state)
     {
-        // There is a hole in changes_for_reader_
+        // There is a hole in the window
         // This means a change was removed.
         return false;
     }
 
-    bool returned_value = chit->getStatus() == UNSENT;
+    bool returned_value = change_status(*state) == UNSENT;
 
     if (returned_value)
     {
-        next_unsent_frag = chit->get_next_unsent_fragment();
+        next_unsent_frag = 1u;
+        if (0 != (*state & change_fragmented_flag))
+        {
+            const ChangeForReader_t* fragmented_change = find_fragmented_change(seq_num);
+            assert(nullptr != fragmented_change);
+            next_unsent_frag = fragmented_change->get_next_unsent_fragment();
+        }
         gap_seq = SequenceNumber_t::unknown();
 
-        if (is_reliable_ && !chit->has_been_delivered())
+        if (is_reliable_ && 0 == (*state & change_delivered_flag))
         {
             need_reactivate_periodic_heartbeat |= true;
-            SequenceNumber_t prev =
-                    (changes_for_reader_.begin() != chit ?
-                    std::prev(chit)->getSequenceNumber() :
-                    changes_low_mark_
-                    ) + 1;
 
-            if (prev != chit->getSequenceNumber())
+            // Look for the previous relevant change on the window
+            SequenceNumber_t prev = changes_low_mark_ + 1;
+            size_t index = static_cast<size_t>(seq_num.to64long() - changes_window_base_.to64long());
+            while (0 < index)
+            {
+                --index;
+                if (0 != (changes_window_[index] & change_relevant_flag))
+                {
+                    prev = changes_window_base_ + static_cast<uint32_t>(index + 1);
+                    break;
+                }
+            }
+
+            if (prev != seq_num)
             {
                 gap_seq = prev;
 
@@ -329,19 +402,24 @@ void ReaderProxy::acked_changes_set(
         const SequenceNumber_t& seq_num)
 {
     SequenceNumber_t future_low_mark = seq_num;
+    SequenceNumber_t previous_low_mark = changes_low_mark_;
 
     if (seq_num > changes_low_mark_)
     {
-        ChangeIterator chit = find_change(seq_num, false);
         // continue advancing until next change is not acknowledged
-        while (chit != changes_for_reader_.end()
-                && chit->getSequenceNumber() == future_low_mark
-                && chit->getStatus() == ACKNOWLEDGED)
+        if (!changes_window_.empty() && future_low_mark >= changes_window_base_)
         {
-            ++chit;
-            ++future_low_mark;
+            size_t index = static_cast<size_t>(future_low_mark.to64long() - changes_window_base_.to64long());
+            size_t first_index = index;
+            while (index < changes_window_.size() &&
+                    0 != (changes_window_[index] & change_relevant_flag) &&
+                    change_status(changes_window_[index]) == ACKNOWLEDGED)
+            {
+                ++index;
+            }
+            future_low_mark += static_cast<uint32_t>(index - first_index);
         }
-        changes_for_reader_.erase(changes_for_reader_.begin(), chit);
+        remove_changes_before(future_low_mark);
     }
     else
     {
@@ -362,35 +440,42 @@ void ReaderProxy::acked_changes_set(
                 }
                 future_low_mark = current_sequence;
 
+                // Changes up to the current low mark are not on the window. Add the ones still in the history.
                 bool should_sort = false;
-                for (; current_sequence <= changes_low_mark_; ++current_sequence)
+                for (auto cit = writer_->mp_history->changesBegin(); cit != writer_->mp_history->changesEnd(); ++cit)
                 {
-                    // Skip all consecutive changes already in the collection
-                    ChangeConstIterator it = find_change(current_sequence);
-                    while ( it != changes_for_reader_.end() &&
-                            current_sequence <= changes_low_mark_ &&
-                            it->getSequenceNumber() == current_sequence)
+                    CacheChange_t* change = *cit;
+                    if (change->sequenceNumber > changes_low_mark_)
                     {
-                        ++current_sequence;
-                        ++it;
+                        break;
                     }
 
-                    if (current_sequence <= changes_low_mark_)
+                    if (change->sequenceNumber < current_sequence || nullptr != find_change_state(
+                                change->sequenceNumber))
                     {
-                        CacheChange_t* change = nullptr;
-                        if (writer_->mp_history->get_change(current_sequence, writer_->getGuid(), &change))
+                        continue;
+                    }
+
+                    uint8_t state = change_relevant_flag | UNACKNOWLEDGED;
+                    if (change_is_fragmented(change))
+                    {
+                        ChangeForReader_t cr(change);
+                        cr.setStatus(UNACKNOWLEDGED);
+                        if (fragmented_changes_.push_back(cr) == nullptr)
                         {
-                            should_sort = true;
-                            ChangeForReader_t cr(change);
-                            cr.setStatus(UNACKNOWLEDGED);
-                            changes_for_reader_.push_back(cr);
+                            continue;
                         }
+                        should_sort = true;
+                        state |= change_fragmented_flag;
                     }
+
+                    window_entry(change->sequenceNumber) = state;
+                    ++changes_per_status_[UNACKNOWLEDGED];
                 }
-                // Keep changes sorted by sequence number
+                // Keep fragmented changes sorted by sequence number
                 if (should_sort)
                 {
-                    std::sort(changes_for_reader_.begin(), changes_for_reader_.end(), ChangeForReaderCmp());
+                    std::sort(fragmented_changes_.begin(), fragmented_changes_.end(), ChangeForReaderCmp());
                 }
             }
             else if (!is_local_reader())
@@ -400,6 +485,11 @@ void ReaderProxy::acked_changes_set(
         }
     }
     changes_low_mark_ = future_low_mark - 1;
+
+    if (changes_low_mark_ != previous_low_mark)
+    {
+        ++writer_->acknowledgement_generation_;
+    }
 }
 
 bool ReaderProxy::requested_changes_set(
@@ -411,23 +501,62 @@ bool ReaderProxy::requested_changes_set(
 
     if (SequenceNumber_t::unknown() != min_seq_in_history)
     {
-        seq_num_set.for_each([&](SequenceNumber_t sit)
+        // Requested changes not on the window, or not relevant, are notified with a GAP
+        SequenceNumber_t first_gap = std::max(min_seq_in_history, changes_low_mark_ + 1);
+        uint32_t num_requested = 0;
+
+        seq_num_set.for_each_run([&](const SequenceNumber_t& first, uint32_t count)
                 {
-                    ChangeIterator chit = find_change(sit, true);
-                    if (chit != changes_for_reader_.end())
+                    SequenceNumber_t sit = first;
+                    uint64_t window_begin = changes_window_base_.to64long();
+                    uint64_t window_end = window_begin + changes_window_.size();
+                    uint64_t seq = first.to64long();
+                    uint64_t run_end = seq + count;
+
+                    // Before the window
+                    for (; seq < run_end && seq < window_begin; ++seq, ++sit)
                     {
-                        if (UNACKNOWLEDGED == chit->getStatus())
+                        if (sit >= first_gap)
                         {
-                            chit->setStatus(REQUESTED);
-                            chit->markAllFragmentsAsUnsent();
-                            isSomeoneWasSetRequested = true;
+                            gap_builder.add(sit);
                         }
                     }
-                    else if ((sit >= min_seq_in_history) && (sit > changes_low_mark_))
+
+                    // On the window
+                    for (; seq < run_end && seq < window_end; ++seq, ++sit)
                     {
-                        gap_builder.add(sit);
+                        uint8_t& state = changes_window_[static_cast<size_t>(seq - window_begin)];
+                        if (0 == (state & change_relevant_flag))
+                        {
+                            if (sit >= first_gap)
+                            {
+                                gap_builder.add(sit);
+                            }
+                        }
+                        else if (UNACKNOWLEDGED == change_status(state))
+                        {
+                            state = static_cast<uint8_t>((state & ~change_status_mask) | REQUESTED);
+                            ++num_requested;
+                            if (0 != (state & change_fragmented_flag))
+                            {
+                                find_fragmented_change(sit)->markAllFragmentsAsUnsent();
+                            }
+                        }
+                    }
+
+                    // After the window
+                    for (; seq < run_end; ++seq, ++sit)
+                    {
+                        if (sit >= first_gap)
+                        {
+                            gap_builder.add(sit);
+                        }
                     }
                 });
+
+        changes_per_status_[UNACKNOWLEDGED] -= num_requested;
+        changes_per_status_[REQUESTED] += num_requested;
+        isSomeoneWasSetRequested = 0 < num_requested;
     }
 
     if (isSomeoneWasSetRequested)
@@ -439,11 +568,20 @@ bool ReaderProxy::requested_changes_set(
 }
 
 bool ReaderProxy::process_initial_acknack(
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(CacheChange_t* change)>& func)
 {
     if (is_local_reader())
     {
-        return 0 != convert_status_on_all_changes(UNACKNOWLEDGED, UNSENT, func);
+        size_t hint = 0;
+        return 0 != convert_status_on_all_changes(UNACKNOWLEDGED, UNSENT,
+                       [this, &func, &hint](const SequenceNumber_t& seq_num, uint8_t)
+                       {
+                           CacheChange_t* change = find_change_in_history(seq_num, hint);
+                           if (func && nullptr != change)
+                           {
+                               func(change);
+                           }
+                       });
     }
 
     return true;
@@ -467,24 +605,26 @@ void ReaderProxy::from_unsent_to_status(
 
     // Called when delivering an UNSENT sample, the seq_number must exists in the ReaderProxy.
     assert(seq_num > changes_low_mark_);
-    ChangeIterator it = find_change(seq_num, true);
-    assert(changes_for_reader_.end() != it);
-    assert(UNSENT == it->getStatus());
+    uint8_t* state = find_change_state(seq_num);
+    assert(nullptr != state);
+    assert(UNSENT == change_status(*state));
     assert(UNSENT != status);
 
+    set_change_status(*state, status);
+
     if (ACKNOWLEDGED == status && seq_num == changes_low_mark_ + 1)
     {
-        assert(changes_for_reader_.begin() == it);
-        changes_for_reader_.erase(it);
         acked_changes_set(seq_num + 1);
         return;
     }
 
-    it->setStatus(status);
-
     if (delivered)
     {
-        it->set_delivered();
+        *state |= change_delivered_flag;
+        if (0 != (*state & change_fragmented_flag))
+        {
+            find_fragmented_change(seq_num)->set_delivered();
+        }
     }
 }
 
@@ -500,51 +640,82 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(
         return false;
     }
 
-    bool change_found = false;
-    ChangeIterator it = find_change(seq_num, true);
+    const uint8_t* state = find_change_state(seq_num);
+    if (nullptr == state)
+    {
+        return false;
+    }
 
-    if (it != changes_for_reader_.end())
+    if (0 != (*state & change_fragmented_flag))
     {
-        change_found = true;
-        it->markFragmentsAsSent(frag_num);
-        was_last_fragment = it->getUnsentFragments().empty();
+        ChangeForReader_t* fragmented_change = find_fragmented_change(seq_num);
+        fragmented_change->markFragmentsAsSent(frag_num);
+        was_last_fragment = fragmented_change->getUnsentFragments().empty();
+    }
+    else
+    {
+        was_last_fragment = true;
     }
 
-    return change_found;
+    return true;
 }
 
 bool ReaderProxy::perform_nack_supression()
 {
-    return 0 != convert_status_on_all_changes(UNDERWAY, UNACKNOWLEDGED);
+    return 0 != convert_status_on_all_changes(UNDERWAY, UNACKNOWLEDGED,
+                   [this](const SequenceNumber_t& seq_num, uint8_t state)
+                   {
+                       // Resent fragments may be requested again once the nack supression period expires.
+                       if (0 != (state & change_fragmented_flag))
+                       {
+                           find_fragmented_change(seq_num)->clearUnderwayFragments();
+                       }
+                   });
 }
 
 uint32_t ReaderProxy::perform_acknack_response(
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(CacheChange_t* change)>& func)
 {
-    return convert_status_on_all_changes(REQUESTED, UNSENT, func);
+    size_t hint = 0;
+    return convert_status_on_all_changes(REQUESTED, UNSENT,
+                   [this, &func, &hint](const SequenceNumber_t& seq_num, uint8_t)
+                   {
+                       if (func)
+                       {
+                           CacheChange_t* change = find_change_in_history(seq_num, hint);
+                           if (nullptr != change)
+                           {
+                               func(change);
+                           }
+                       }
+                   });
 }
 
 uint32_t ReaderProxy::convert_status_on_all_changes(
         ChangeForReaderStatus_t previous,
         ChangeForReaderStatus_t next,
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(const SequenceNumber_t& seq_num, uint8_t state)>& func)
 {
     assert(previous > next);
 
     // NOTE: This is only called for REQUESTED=>UNSENT (acknack response) or
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
+    // The status counters let us stop as soon as all the changes with the previous status have been found.
+    uint32_t pending = changes_per_status_[previous];
     uint32_t changed = 0;
-    for (ChangeForReader_t& change : changes_for_reader_)
+    for (size_t index = 0; 0 < pending && index < changes_window_.size(); ++index)
     {
-        if (change.getStatus() == previous)
+        uint8_t& state = changes_window_[index];
+        if (0 != (state & change_relevant_flag) && change_status(state) == previous)
         {
+            --pending;
             ++changed;
-            change.setStatus(next);
+            set_change_status(state, next);
 
             if (func)
             {
-                func(change);
+                func(changes_window_base_ + static_cast<uint32_t>(index), state);
             }
         }
     }
@@ -555,34 +726,40 @@ uint32_t ReaderProxy::convert_status_on_all_changes(
 void ReaderProxy::change_has_been_removed(
         const SequenceNumber_t& seq_num)
 {
-    // Check sequence number is in the container, because it was not clean up.
-    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->getSequenceNumber())
-    {
-        return;
-    }
-
-    auto chit = find_change(seq_num);
-
-    if (chit == this->changes_for_reader_.end())
+    // Check sequence number is in the window, because it was not clean up.
+    uint8_t* state = find_change_state(seq_num);
+    if (nullptr == state)
     {
         // No change for this sequence number
         return;
     }
 
     // In intraprocess, if there is an UNACKNOWLEDGED, a GAP has to be send because there is no reliable mechanism.
-    if (is_local_reader() && ACKNOWLEDGED > chit->getStatus())
+    if (is_local_reader() && ACKNOWLEDGED > change_status(*state))
     {
         writer_->intraprocess_gap(this, seq_num);
     }
 
-    // Element may not be in the container when marked as irrelevant.
-    changes_for_reader_.erase(chit);
+    // Make the entry a hole on the window.
+    --changes_per_status_[change_status(*state)];
+    if (0 != (*state & change_fragmented_flag))
+    {
+        auto it = std::lower_bound(fragmented_changes_.begin(), fragmented_changes_.end(), seq_num,
+                        change_less_than_sequence);
+        assert(it != fragmented_changes_.end() && it->getSequenceNumber() == seq_num);
+        fragmented_changes_.erase(it);
+    }
+    *state = 0;
 
     // When removing the next-to-be-acknowledged, we should auto-acknowledge it.
     if ((changes_low_mark_ + 1) == seq_num)
     {
         acked_changes_set(seq_num + 1);
     }
+    else
+    {
+        remove_changes_before(changes_window_base_);
+    }
 }
 
 bool ReaderProxy::has_unacknowledged(
@@ -593,15 +770,7 @@ bool ReaderProxy::has_unacknowledged(
         return true;
     }
 
-    for (const ChangeForReader_t& it : changes_for_reader_)
-    {
-        if (it.getStatus() == UNACKNOWLEDGED)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return 0 < changes_per_status_[UNACKNOWLEDGED];
 }
 
 bool ReaderProxy::requested_fragment_set(
@@ -609,18 +778,29 @@ bool ReaderProxy::requested_fragment_set(
         const FragmentNumberSet_t& frag_set)
 {
     // Locate the outbound change referenced by the NACK_FRAG
-    ChangeIterator changeIter = find_change(seq_num, true);
-    if (changeIter == changes_for_reader_.end())
+    uint8_t* state = find_change_state(seq_num);
+    if (nullptr == state)
     {
         return false;
     }
 
-    changeIter->markFragmentsAsUnsent(frag_set);
+    // Fragments already being resent are not requested again.
+    if (0 != (*state & change_fragmented_flag))
+    {
+        if (!find_fragmented_change(seq_num)->markFragmentsAsUnsent(frag_set))
+        {
+            return false;
+        }
+    }
+    else if (0 == (*state & change_delivered_flag) || frag_set.empty())
+    {
+        return false;
+    }
 
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
-    if (changeIter->getStatus() != UNSENT)
+    if (change_status(*state) != UNSENT)
     {
-        changeIter->setStatus(REQUESTED);
+        set_change_status(*state, REQUESTED);
     }
 
     return true;
@@ -647,38 +827,147 @@ bool ReaderProxy::process_nack_frag(
     return false;
 }
 
-static bool change_less_than_sequence(
-        const ChangeForReader_t& change,
+uint8_t* ReaderProxy::find_change_state(
         const SequenceNumber_t& seq_num)
 {
-    return change.getSequenceNumber() < seq_num;
+    return const_cast<uint8_t*>(static_cast<const ReaderProxy*>(this)->find_change_state(seq_num));
 }
 
-ReaderProxy::ChangeIterator ReaderProxy::find_change(
-        const SequenceNumber_t& seq_num,
-        bool exact)
+const uint8_t* ReaderProxy::find_change_state(
+        const SequenceNumber_t& seq_num) const
 {
-    ReaderProxy::ChangeIterator it;
-    ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    if (changes_window_.empty() || seq_num < changes_window_base_)
+    {
+        return nullptr;
+    }
 
-    return (!exact)
-           ? it
-           : it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
+    uint64_t index = seq_num.to64long() - changes_window_base_.to64long();
+    if (index >= changes_window_.size())
+    {
+        return nullptr;
+    }
+
+    const uint8_t& state = changes_window_[static_cast<size_t>(index)];
+    return 0 != (state & change_relevant_flag) ? &state : nullptr;
 }
 
-ReaderProxy::ChangeConstIterator ReaderProxy::find_change(
+uint8_t& ReaderProxy::window_entry(
+        const SequenceNumber_t& seq_num)
+{
+    if (changes_window_.empty())
+    {
+        changes_window_base_ = seq_num;
+        changes_window_.push_back(0);
+        return changes_window_.front();
+    }
+
+    if (seq_num < changes_window_base_)
+    {
+        // Only happens when adding changes older than the low mark on a late joiner.
+        size_t count = static_cast<size_t>(changes_window_base_.to64long() - seq_num.to64long());
+        changes_window_.reserve(changes_window_.size() + count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            changes_window_.push_front(0);
+        }
+        changes_window_base_ = seq_num;
+        return changes_window_.front();
+    }
+
+    size_t index = static_cast<size_t>(seq_num.to64long() - changes_window_base_.to64long());
+    if (index >= changes_window_.size())
+    {
+        changes_window_.reserve(index + 1);
+        while (index >= changes_window_.size())
+        {
+            changes_window_.push_back(0);
+        }
+    }
+    return changes_window_[index];
+}
+
+void ReaderProxy::set_change_status(
+        uint8_t& state,
+        ChangeForReaderStatus_t status)
+{
+    assert(0 != (state & change_relevant_flag));
+    --changes_per_status_[change_status(state)];
+    ++changes_per_status_[status];
+    state = static_cast<uint8_t>((state & ~change_status_mask) | status);
+}
+
+void ReaderProxy::remove_changes_before(
+        const SequenceNumber_t& seq_num)
+{
+    size_t count = 0;
+    SequenceNumber_t seq = changes_window_base_;
+    while (count < changes_window_.size() &&
+            (seq < seq_num || 0 == (changes_window_[count] & change_relevant_flag)))
+    {
+        uint8_t state = changes_window_[count];
+        if (0 != (state & change_relevant_flag))
+        {
+            --changes_per_status_[change_status(state)];
+        }
+        ++count;
+        ++seq;
+    }
+    changes_window_.erase(changes_window_.begin(), changes_window_.begin() + count);
+    changes_window_base_ = seq;
+
+    // Fragmentation state of the removed changes.
+    SequenceNumber_t first_kept = changes_window_.empty() ? seq_num : changes_window_base_;
+    if (!fragmented_changes_.empty() && fragmented_changes_.front().getSequenceNumber() < first_kept)
+    {
+        fragmented_changes_.erase(fragmented_changes_.begin(),
+                std::lower_bound(fragmented_changes_.begin(), fragmented_changes_.end(), first_kept,
+                change_less_than_sequence));
+    }
+}
+
+ChangeForReader_t* ReaderProxy::find_fragmented_change(
+        const SequenceNumber_t& seq_num)
+{
+    return const_cast<ChangeForReader_t*>(static_cast<const ReaderProxy*>(this)->find_fragmented_change(seq_num));
+}
+
+const ChangeForReader_t* ReaderProxy::find_fragmented_change(
         const SequenceNumber_t& seq_num) const
 {
-    ReaderProxy::ChangeConstIterator it;
-    ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    auto it = std::lower_bound(fragmented_changes_.begin(), fragmented_changes_.end(), seq_num,
+                    change_less_than_sequence);
+    if (it != fragmented_changes_.end() && it->getSequenceNumber() == seq_num)
+    {
+        return &(*it);
+    }
+
+    return nullptr;
+}
+
+CacheChange_t* ReaderProxy::find_change_in_history(
+        const SequenceNumber_t& seq_num,
+        size_t& hint) const
+{
+    auto begin = writer_->mp_history->changesBegin();
+    auto end = writer_->mp_history->changesEnd();
+    if (static_cast<size_t>(std::distance(begin, end)) <= hint)
+    {
+        return nullptr;
+    }
+
+    auto it = std::lower_bound(begin + hint, end, seq_num,
+                    [](const CacheChange_t* change, const SequenceNumber_t& seq)
+                    {
+                        return change->sequenceNumber < seq;
+                    });
+    hint = static_cast<size_t>(std::distance(begin, it));
+
+    if (it != end && (*it)->sequenceNumber == seq_num)
+    {
+        return *it;
+    }
 
-    return it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
+    return nullptr;
 }
 
 bool ReaderProxy::has_been_delivered(
@@ -691,11 +980,11 @@ bool ReaderProxy::has_been_delivered(
         return true;
     }
 
-    ChangeConstIterator it = find_change(seq_number);
-    if (it != changes_for_reader_.end())
+    const uint8_t* state = find_change_state(seq_number);
+    if (nullptr != state)
     {
         found = true;
-        return it->has_been_delivered();
+        return 0 != (*state & change_delivered_flag);
     }
 
     return false;
@@ -414,15 +414,16 @@ void StatefulWriter::unsent_change_added_to_history(
     if (!matched_remote_readers_.empty() || !matched_datasharing_readers_.empty() || !matched_local_readers_.empty())
     {
         bool should_be_sent = false;
+        // The same ChangeForReader_t is used for all readers, as ReaderProxy only keeps its status.
+        ChangeForReader_t changeForReader(change);
         for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-                [this, &should_be_sent, &change, &max_blocking_time](ReaderProxy* reader)
+                [this, &should_be_sent, &change, &changeForReader, &max_blocking_time](ReaderProxy* reader)
                 {
-                    ChangeForReader_t changeForReader(change);
                     bool is_revelant = reader->rtps_is_relevant(change);
 
                     if (m_pushMode || !reader->is_reliable() || reader->is_local_reader())
                     {
-                        //ChangeForReader_t construct sets status to UNSENT.
+                        changeForReader.setStatus(UNSENT);
                         should_be_sent |= is_revelant;
                     }
                     else
@@ -504,7 +505,8 @@ bool StatefulWriter::intraprocess_heartbeat(
     bool returned_value = false;
 
     std::lock_guard<RecursiveTimedMutex> guardW(mp_mutex);
-    RTPSReader* reader = RTPSDomainImpl::find_local_reader(reader_proxy->guid());
+    // Use the reader pointer cached on the proxy, avoiding a domain-wide lookup on every sample.
+    RTPSReader* reader = reader_proxy->local_reader();
 
     if (reader)
     {
@@ -637,12 +639,13 @@ void StatefulWriter::deliver_sample_to_intraprocesses(
             }
             else
             {
-                intraprocess_heartbeat(remoteReader, false);
                 remoteReader->from_unsent_to_status(
                     change->sequenceNumber,
                     delivered ? ACKNOWLEDGED : UNACKNOWLEDGED,
                     false,
                     delivered);
+                // Called after updating the status, so no heartbeat is sent when nothing is pending for the reader.
+                intraprocess_heartbeat(remoteReader, false);
             }
         }
     }
@@ -1012,6 +1015,8 @@ bool StatefulWriter::matched_reader_add(
     }
 
     std::unique_lock<RecursiveTimedMutex> guard(mp_mutex);
+    // Either a new reader or an update of a matched one, which may change the relevance of the changes
+    ++acknowledgement_generation_;
     std::unique_lock<LocatorSelectorSender> guard_locator_selector_general(locator_selector_general_);
     std::unique_lock<LocatorSelectorSender> guard_locator_selector_async(locator_selector_async_);
 
@@ -1281,6 +1286,7 @@ bool StatefulWriter::matched_reader_remove(
     {
         rproxy->stop();
         matched_readers_pool_.push_back(rproxy);
+        ++acknowledgement_generation_;
 
         check_acked_status();
 
@@ -1564,6 +1570,9 @@ bool StatefulWriter::try_remove_change(
 
     if (calc <= SequenceNumber_t())
     {
+        // Samples grouped on a batch should be sent before waiting for them to be acknowledged
+        flush_sample_batch_nts();
+
         may_remove_change_ = 0;
         may_remove_change_cond_.wait_until(lock, max_blocking_time_point,
                 [&]()
@@ -1856,11 +1865,11 @@ void StatefulWriter::perform_nack_response()
     uint32_t changes_to_resend = 0;
     for (ReaderProxy* reader : matched_remote_readers_)
     {
-        changes_to_resend += reader->perform_acknack_response([&](ChangeForReader_t& change)
+        changes_to_resend += reader->perform_acknack_response([&](CacheChange_t* change)
                         {
-                            // This labmda is called if the ChangeForReader_t pass from REQUESTED to UNSENT.
-                            assert(nullptr != change.getChange());
-                            flow_controller_->add_old_sample(this, change.getChange());
+                            // This labmda is called if the change pass from REQUESTED to UNSENT.
+                            assert(nullptr != change);
+                            flow_controller_->add_old_sample(this, change);
                         }
                         );
     }
@@ -1935,10 +1944,10 @@ bool StatefulWriter::process_acknack(
                                 else if (sn_set.empty() && !final_flag)
                                 {
                                     // This is the preemptive acknack.
-                                    if (remote_reader->process_initial_acknack([&](ChangeForReader_t& change_reader)
+                                    if (remote_reader->process_initial_acknack([&](CacheChange_t* change)
                                     {
-                                        assert(nullptr != change_reader.getChange());
-                                        flow_controller_->add_old_sample(this, change_reader.getChange());
+                                        assert(nullptr != change);
+                                        flow_controller_->add_old_sample(this, change);
                                     }))
                                     {
                                         if (remote_reader->is_remote_and_reliable())
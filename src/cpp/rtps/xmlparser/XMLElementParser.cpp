@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <cerrno>
+#include <cstdlib>
 #include <cstring>
 #include <regex>
 #include <string>
@@ -599,6 +601,73 @@ XMLP_ret XMLParser::getXMLInitialAnnouncementsConfig(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLThreadSettings(
+        tinyxml2::XMLElement* elem,
+        eprosima::fastdds::rtps::ThreadSettings& thread_setting,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="threadSettingsType">
+            <xs:all minOccurs="0">
+                <xs:element name="scheduling_policy" type="int32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="priority" type="int32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="affinity" type="uint64Type" minOccurs="0" maxOccurs="1"/>
+            </xs:all>
+        </xs:complexType>
+     */
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, SCHEDULING_POLICY) == 0)
+        {
+            // scheduling_policy - int32Type
+            int policy = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &policy, ident) || policy < -1)
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            thread_setting.scheduling_policy = policy;
+        }
+        else if (strcmp(name, PRIORITY) == 0)
+        {
+            // priority - int32Type
+            int priority = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &priority, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            thread_setting.priority = priority;
+        }
+        else if (strcmp(name, AFFINITY) == 0)
+        {
+            // affinity - uint64Type, decimal or hexadecimal
+            const char* text = p_aux0->GetText();
+            char* end = nullptr;
+            if (nullptr == text || '-' == text[0])
+            {
+                EPROSIMA_LOG_ERROR(XMLPARSER, "<" << p_aux0->Value() << "> getXMLThreadSettings XML_ERROR!");
+                return XMLP_ret::XML_ERROR;
+            }
+            errno = 0;
+            unsigned long long affinity = std::strtoull(text, &end, 0);
+            if (0 != errno || end == text || '\0' != *end)
+            {
+                EPROSIMA_LOG_ERROR(XMLPARSER, "<" << p_aux0->Value() << "> getXMLThreadSettings XML_ERROR!");
+                return XMLP_ret::XML_ERROR;
+            }
+            thread_setting.affinity = static_cast<uint64_t>(affinity);
+        }
+        else
+        {
+            EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid element found into 'threadSettingsType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLPortParameters(
         tinyxml2::XMLElement* elem,
         PortParameters& port,
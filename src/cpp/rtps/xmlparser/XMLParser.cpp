@@ -410,6 +410,7 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 <xs:element name="logical_port_increment" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="metadata_logical_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="listening_ports" type="portListType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="default_reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -495,6 +496,14 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 }
             }
         }
+        else if (strcmp(name, DEFAULT_RECEPTION_THREADS) == 0)
+        {
+            // default_reception_threads - threadSettingsType
+            if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0, pDesc->default_reception_threads, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, TCP_WAN_ADDR) == 0 || strcmp(name, UDP_OUTPUT_PORT) == 0 ||
                 strcmp(name, TRANSPORT_ID) == 0 || strcmp(name, TYPE) == 0 ||
                 strcmp(name, KEEP_ALIVE_FREQUENCY) == 0 || strcmp(name, KEEP_ALIVE_TIMEOUT) == 0 ||
@@ -506,6 +515,7 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 strcmp(name, SEGMENT_SIZE) == 0 || strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, PORT_OVERFLOW_POLICY) == 0 || strcmp(name, SEGMENT_OVERFLOW_POLICY) == 0 ||
                 strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 || strcmp(name, HEALTHY_CHECK_TIMEOUT_MS) == 0 ||
+                strcmp(name, WAIT_SPIN_TIME_US) == 0 || strcmp(name, WAIT_YIELD_TIME_US) == 0 ||
                 strcmp(name, RTPS_DUMP_FILE) == 0)
         {
             // Parsed outside of this method
@@ -686,7 +696,10 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="segment_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="port_queue_capacity" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="wait_spin_time_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="wait_yield_time_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="default_reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
         </xs:complexType>
      */
@@ -726,6 +739,22 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->healthy_check_timeout_ms(static_cast<uint32_t>(aux));
             }
+            else if (strcmp(name, WAIT_SPIN_TIME_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->wait_spin_time_us(static_cast<uint32_t>(aux));
+            }
+            else if (strcmp(name, WAIT_YIELD_TIME_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->wait_yield_time_us(static_cast<uint32_t>(aux));
+            }
             else if (strcmp(name, RTPS_DUMP_FILE) == 0)
             {
                 std::string str;
@@ -755,6 +784,15 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->maxInitialPeersRange = uRange;
             }
+            else if (strcmp(name, DEFAULT_RECEPTION_THREADS) == 0)
+            {
+                // default_reception_threads - threadSettingsType
+                if (XMLP_ret::XML_OK !=
+                        getXMLThreadSettings(p_aux0, transport_descriptor->default_reception_threads, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, TRANSPORT_ID) == 0 || strcmp(name, TYPE) == 0)
             {
                 // Parsed Outside of this method
@@ -1401,6 +1439,7 @@ XMLP_ret XMLParser::parseLogConfig(
                 <xs:element name="propertyType"/>
               </xs:sequence>
             </xs:complexType>
+          <xs:element name="thread_settings" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
         </xs:sequence>
        </xs:complexType>
        </xs:element>
@@ -1440,13 +1479,23 @@ XMLP_ret XMLParser::parseLogConfig(
                     return ret;
                 }
             }
+            else if (strcmp(tag, THREAD_SETTINGS) == 0)
+            {
+                fastdds::rtps::ThreadSettings thread_settings;
+                ret = getXMLThreadSettings(p_element, thread_settings, 0);
+                if (ret == XMLP_ret::XML_ERROR)
+                {
+                    return ret;
+                }
+                eprosima::fastdds::dds::Log::SetThreadConfig(thread_settings);
+            }
             else
             {
                 EPROSIMA_LOG_ERROR(XMLPARSER, "Not expected tag: '" << tag << "'");
                 ret = XMLP_ret::XML_ERROR;
             }
         }
-        p_element = p_element->NextSiblingElement(CONSUMER);
+        p_element = p_element->NextSiblingElement();
     }
     return ret;
 }
@@ -1742,6 +1791,11 @@ XMLP_ret XMLParser::fillDataNode(
                 <xs:element name="useBuiltinTransports" type="boolType" minOccurs="0"/>
                 <xs:element name="propertiesPolicy" type="propertyPolicyType" minOccurs="0"/>
                 <xs:element name="name" type="stringType" minOccurs="0"/>
+                <xs:element name="builtin_transports_reception_threads" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="timed_events_thread" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="discovery_server_thread" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="builtin_controllers_sender_thread" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="data_sharing_listener_thread" type="threadSettingsType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -1936,6 +1990,53 @@ XMLP_ret XMLParser::fillDataNode(
             }
             participant_node.get()->rtps.setName(s.c_str());
         }
+        else if (strcmp(name, BUILTIN_TRANSPORTS_RECEPTION_THREADS) == 0)
+        {
+            // builtin_transports_reception_threads - threadSettingsType
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.builtin_transports_reception_threads,
+                    ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, TIMED_EVENTS_THREAD) == 0)
+        {
+            // timed_events_thread - threadSettingsType
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.timed_events_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, DISCOVERY_SERVER_THREAD) == 0)
+        {
+            // discovery_server_thread - threadSettingsType
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.discovery_server_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, BUILTIN_CONTROLLERS_SENDER_THREAD) == 0)
+        {
+            // builtin_controllers_sender_thread - threadSettingsType
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.builtin_controllers_sender_thread,
+                    ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, DATA_SHARING_LISTENER_THREAD) == 0)
+        {
+            // data_sharing_listener_thread - threadSettingsType
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.data_sharing_listener_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid element found into 'rtpsParticipantAttributesType'. Name: " << name);
@@ -64,9 +64,12 @@ const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
 const char* SEGMENT_OVERFLOW_POLICY = "segment_overflow_policy";
 const char* HEALTHY_CHECK_TIMEOUT_MS = "healthy_check_timeout_ms";
+const char* WAIT_SPIN_TIME_US = "wait_spin_time_us";
+const char* WAIT_YIELD_TIME_US = "wait_yield_time_us";
 const char* DISCARD = "DISCARD";
 const char* FAIL = "FAIL";
 const char* RTPS_DUMP_FILE = "rtps_dump_file";
+const char* DEFAULT_RECEPTION_THREADS = "default_reception_threads";
 const char* ON = "ON";
 
 const char* OFF = "OFF";
@@ -101,6 +104,11 @@ const char* PART_ID = "participantID";
 const char* THROUGHPUT_CONT = "throughputController";
 const char* USER_TRANS = "userTransports";
 const char* USE_BUILTIN_TRANS = "useBuiltinTransports";
+const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS = "builtin_transports_reception_threads";
+const char* TIMED_EVENTS_THREAD = "timed_events_thread";
+const char* DISCOVERY_SERVER_THREAD = "discovery_server_thread";
+const char* BUILTIN_CONTROLLERS_SENDER_THREAD = "builtin_controllers_sender_thread";
+const char* DATA_SHARING_LISTENER_THREAD = "data_sharing_listener_thread";
 const char* PROPERTIES_POLICY = "propertiesPolicy";
 const char* NAME = "name";
 const char* REMOTE_LOCATORS = "remote_locators";
@@ -379,6 +387,12 @@ const char* BASE_TYPE = "baseType";
 const char* USE_DEFAULT = "use_default";
 const char* CONSUMER = "consumer";
 const char* CLASS = "class";
+const char* THREAD_SETTINGS = "thread_settings";
+
+// Thread settings
+const char* SCHEDULING_POLICY = "scheduling_policy";
+const char* PRIORITY = "priority";
+const char* AFFINITY = "affinity";
 
 // Allocation config
 const char* INITIAL = "initial";
@@ -0,0 +1,121 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StartupPhaseTimer.hpp
+ */
+
+#ifndef UTILS_STARTUPPHASETIMER_HPP_
+#define UTILS_STARTUPPHASETIMER_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <fastdds/dds/log/Log.hpp>
+
+namespace eprosima {
+
+/**
+ * Measures the consecutive phases of the creation of an entity and reports them as an info log message of
+ * category STARTUP.
+ *
+ * Each call to @ref phase_finished closes the phase started by the previous one (or by the construction of the
+ * timer).
+ * The report is only emitted on builds where info messages are compiled in (see FASTDDS_ENFORCE_LOG_INFO).
+ */
+class StartupPhaseTimer
+{
+    using clock = std::chrono::steady_clock;
+
+public:
+
+    static constexpr size_t max_phases = 8;
+
+    /**
+     * Start measuring the first phase.
+     *
+     * @param entity  Description of the entity being created, used as prefix of the report.
+     */
+    explicit StartupPhaseTimer(
+            const std::string& entity)
+        : entity_(entity)
+        , start_(clock::now())
+        , last_(start_)
+    {
+    }
+
+    /**
+     * Close the current phase and start the next one.
+     *
+     * @param name  Name of the phase being closed. Must be a string literal.
+     */
+    void phase_finished(
+            const char* name)
+    {
+        clock::time_point now = clock::now();
+        if (num_phases_ < max_phases)
+        {
+            phases_[num_phases_].name = name;
+            phases_[num_phases_].duration = std::chrono::duration_cast<std::chrono::microseconds>(now - last_);
+            ++num_phases_;
+        }
+        last_ = now;
+    }
+
+    /**
+     * Log the duration of every closed phase and the total time since construction.
+     */
+    void report() const
+    {
+        EPROSIMA_LOG_INFO(STARTUP, entity_ << " startup: " << phases_text() << "total="
+                                           << std::chrono::duration_cast<std::chrono::microseconds>(
+                    last_ - start_).count() << "us");
+    }
+
+private:
+
+    struct Phase
+    {
+        const char* name = nullptr;
+        std::chrono::microseconds duration{0};
+    };
+
+    std::string phases_text() const
+    {
+        std::string text;
+        for (size_t i = 0; i < num_phases_; ++i)
+        {
+            text += phases_[i].name;
+            text += "=" + std::to_string(phases_[i].duration.count()) + "us ";
+        }
+        return text;
+    }
+
+    std::string entity_;
+
+    clock::time_point start_;
+
+    clock::time_point last_;
+
+    std::array<Phase, max_phases> phases_;
+
+    size_t num_phases_ = 0;
+};
+
+} // namespace eprosima
+
+#endif  // UTILS_STARTUPPHASETIMER_HPP_
@@ -22,6 +22,8 @@
 #include <thread>
 #include <unordered_set>
 
+#include <utils/threading.hpp>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -121,6 +123,9 @@ private:
 
     void run()
     {
+        // Shared by every participant of the process, so it keeps the inherited scheduling settings
+        configure_current_thread(ThreadSettings(), "dds.shm.wdog", 0);
+
         while (!exit_thread_)
         {
             {
@@ -0,0 +1,191 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_THREADING_HPP_
+#define UTILS_THREADING_HPP_
+
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif // if defined(__linux__)
+#endif // if defined(_WIN32)
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+namespace eprosima {
+
+/**
+ * Give a name to the thread calling this function.
+ *
+ * @param fmt   A null-terminated string to be used as the format argument of a `snprintf` like function,
+ *              in order to accomodate the restrictions of the OS. Those restrictions are:
+ *              - Linux: 16 characters (including the terminating null character)
+ *              - Windows: Not applied
+ *              - Mac OS: 64 characters (including the terminating null character)
+ * @param arg   A single variadic argument passed to the formatting function.
+ */
+inline void set_name_to_current_thread(
+        const char* fmt,
+        uint32_t arg)
+{
+#if defined(__linux__)
+    char thread_name[16]{};
+    snprintf(thread_name, sizeof(thread_name), fmt, arg);
+    pthread_setname_np(pthread_self(), thread_name);
+#elif defined(__APPLE__)
+    char thread_name[64]{};
+    snprintf(thread_name, sizeof(thread_name), fmt, arg);
+    pthread_setname_np(thread_name);
+#else
+    static_cast<void>(fmt);
+    static_cast<void>(arg);
+#endif // if defined(__linux__)
+}
+
+/**
+ * Apply scheduling policy, priority and affinity to the thread calling this function.
+ * Errors are logged and the corresponding setting is left untouched.
+ *
+ * @param settings  The settings to apply.
+ */
+inline void apply_thread_settings_to_current_thread(
+        const fastdds::rtps::ThreadSettings& settings)
+{
+    constexpr int32_t default_priority = std::numeric_limits<int32_t>::min();
+
+#if defined(_WIN32)
+    HANDLE handle = GetCurrentThread();
+
+    if (settings.priority != default_priority && 0 == SetThreadPriority(handle, settings.priority))
+    {
+        EPROSIMA_LOG_WARNING(SYSTEM, "Could not set priority " << settings.priority
+                                                               << " to thread. Error " << GetLastError());
+    }
+
+    if (0 != settings.affinity &&
+            0 == SetThreadAffinityMask(handle, static_cast<DWORD_PTR>(settings.affinity)))
+    {
+        EPROSIMA_LOG_WARNING(SYSTEM, "Could not set affinity " << settings.affinity
+                                                               << " to thread. Error " << GetLastError());
+    }
+#else
+    pthread_t self_tid = pthread_self();
+    int result = 0;
+
+    int policy = 0;
+    sched_param param{};
+    result = pthread_getschedparam(self_tid, &policy, &param);
+    if (0 != result)
+    {
+        EPROSIMA_LOG_WARNING(SYSTEM, "Could not get scheduling parameters of thread. Error " << result);
+        return;
+    }
+
+    if (settings.scheduling_policy >= 0)
+    {
+        policy = settings.scheduling_policy;
+    }
+
+    bool is_realtime = (SCHED_FIFO == policy) || (SCHED_RR == policy);
+    if (is_realtime && settings.priority != default_priority)
+    {
+        param.sched_priority = settings.priority;
+    }
+    else if (!is_realtime)
+    {
+        // Non real-time policies only accept a static priority of 0
+        param.sched_priority = 0;
+    }
+
+    if (settings.scheduling_policy >= 0 || (is_realtime && settings.priority != default_priority))
+    {
+        result = pthread_setschedparam(self_tid, policy, &param);
+        if (0 != result)
+        {
+            EPROSIMA_LOG_WARNING(SYSTEM, "Could not set scheduling policy " << policy << " with priority "
+                                                                            << param.sched_priority
+                                                                            << " to thread. Error " << result);
+        }
+    }
+
+    if (!is_realtime && settings.priority != default_priority)
+    {
+        // For non real-time policies the priority is the nice value of the thread
+#if defined(__linux__)
+        id_t tid = static_cast<id_t>(syscall(SYS_gettid));
+        if (0 != setpriority(PRIO_PROCESS, tid, settings.priority))
+        {
+            EPROSIMA_LOG_WARNING(SYSTEM, "Could not set nice value " << settings.priority << " to thread");
+        }
+#else
+        EPROSIMA_LOG_WARNING(SYSTEM, "Thread priority is not supported with scheduling policy " << policy);
+#endif // if defined(__linux__)
+    }
+
+    if (0 != settings.affinity)
+    {
+#if defined(__linux__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (uint32_t core = 0; core < 64 && core < CPU_SETSIZE; ++core)
+        {
+            if (0 != (settings.affinity & (uint64_t(1) << core)))
+            {
+                CPU_SET(core, &cpu_set);
+            }
+        }
+
+        result = pthread_setaffinity_np(self_tid, sizeof(cpu_set_t), &cpu_set);
+        if (0 != result)
+        {
+            EPROSIMA_LOG_WARNING(SYSTEM, "Could not set affinity " << settings.affinity
+                                                                   << " to thread. Error " << result);
+        }
+#else
+        EPROSIMA_LOG_WARNING(SYSTEM, "Thread affinity is not supported on this platform");
+#endif // if defined(__linux__)
+    }
+#endif // if defined(_WIN32)
+}
+
+/**
+ * Name the thread calling this function and apply the given settings to it.
+ *
+ * @param settings  The settings to apply.
+ * @param fmt       Format of the thread name. See @ref set_name_to_current_thread.
+ * @param arg       Argument for the thread name format.
+ */
+inline void configure_current_thread(
+        const fastdds::rtps::ThreadSettings& settings,
+        const char* fmt,
+        uint32_t arg)
+{
+    set_name_to_current_thread(fmt, arg);
+    apply_thread_settings_to_current_thread(settings);
+}
+
+} // namespace eprosima
+
+#endif  // UTILS_THREADING_HPP_
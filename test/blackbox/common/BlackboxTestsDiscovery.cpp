@@ -596,6 +596,42 @@ TEST(Discovery, ParticipantLivelinessAssertion)
     thread.join();
 }
 
+/*
+ * Participants sharing the timed events thread of the process should discover each other, communicate reliably,
+ * and keep working while other participants sharing it are created and destroyed.
+ */
+TEST(Discovery, SharedTimedEventsThread)
+{
+    PropertyPolicy property_policy;
+    property_policy.properties().emplace_back("fastdds.shared_timed_events_thread", "true");
+
+    PubSubReader<HelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+    reader.property_policy(property_policy).reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    // Participants sharing the thread are created and destroyed while the remaining one keeps using it. The timed
+    // events of a destroyed participant must not be triggered after it has been disabled.
+    for (int i = 0; i < 5; ++i)
+    {
+        PubSubWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+        writer.property_policy(property_policy).init();
+        ASSERT_TRUE(writer.isInitialized());
+
+        writer.wait_discovery();
+        reader.wait_discovery();
+
+        auto data = default_helloworld_data_generator();
+        reader.startReception(data);
+        writer.send(data);
+        ASSERT_TRUE(data.empty());
+        reader.block_for_all();
+        reader.stopReception();
+        writer.destroy();
+
+        reader.wait_participant_undiscovery();
+    }
+}
+
 // Regression test of Refs #2535, github micro-RTPS #1
 TEST(Discovery, PubXmlLoadedPartition)
 {
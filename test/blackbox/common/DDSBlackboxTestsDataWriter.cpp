@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <chrono>
+#include <vector>
 
 #include "BlackboxTests.hpp"
 
@@ -369,6 +371,78 @@ TEST(DDSDataWriter, OfferedDeadlineMissedListener)
     ASSERT_TRUE(ret);
 }
 
+/**
+ * This test checks that DataWriter::write_batch packs the samples on fewer datagrams than samples, and that all of
+ * them are received in order.
+ * The datagrams carrying DATA submessages of user writers are counted on the test transport of the writer.
+ */
+TEST(DDSDataWriter, WriteBatchPacksSamples)
+{
+    PubSubWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+
+    std::atomic<uint32_t> num_datagrams{0};
+    std::atomic<uint32_t> num_data{0};
+    auto test_transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    test_transport->messages_filter_ = [&num_datagrams, &num_data](rtps::CDRMessage_t& msg)
+            {
+                uint32_t data_in_datagram = 0;
+                uint32_t pos = RTPSMESSAGE_HEADER_SIZE;
+                while (pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE <= msg.length)
+                {
+                    rtps::octet id = msg.buffer[pos];
+                    bool little_endian = 0 != (msg.buffer[pos + 1] & 0x01);
+                    uint32_t length = little_endian ?
+                            (msg.buffer[pos + 2] | (msg.buffer[pos + 3] << 8)) :
+                            ((msg.buffer[pos + 2] << 8) | msg.buffer[pos + 3]);
+                    pos += RTPSMESSAGE_SUBMESSAGEHEADER_SIZE;
+
+                    // The writer entity id follows the extra flags, the octets to inline QoS and the reader id.
+                    // Built-in entities have their two most significant bits of the kind set.
+                    if (rtps::DATA == id && pos + 12 <= msg.length && 0 == (msg.buffer[pos + 11] & 0xc0))
+                    {
+                        ++data_in_datagram;
+                    }
+                    pos += length;
+                }
+
+                if (0 < data_in_datagram)
+                {
+                    ++num_datagrams;
+                    num_data += data_in_datagram;
+                }
+                return false;
+            };
+
+    writer.disable_builtin_transport().add_user_transport_to_pparams(test_transport)
+            .history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(20);
+    size_t num_samples = data.size();
+    reader.startReception(data);
+
+    std::vector<void*> samples;
+    for (HelloWorld& sample : data)
+    {
+        samples.push_back(&sample);
+    }
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, writer.get_native_writer().write_batch(samples));
+
+    // The reader checks that the samples are received in order
+    reader.block_for_all();
+    EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(1)));
+
+    EXPECT_GE(num_data.load(), num_samples);
+    EXPECT_LT(num_datagrams.load(), num_samples / 2);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
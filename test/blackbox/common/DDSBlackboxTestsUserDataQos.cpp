@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "BlackboxTests.hpp"
@@ -118,6 +120,49 @@ TEST_P(UserDataQos, update_user_data_qos)
     participant_2.wait_qos_update();
 }
 
+/**
+ * This test checks that periodic announcements without changes keep refreshing the remote participant and are still
+ * notified to the listener, and that a change on the announcements is still applied.
+ * The announcing participant uses a short lease, so it would be dropped if the unchanged announcements were not
+ * processed.
+ */
+TEST_P(UserDataQos, unchanged_announcements_keep_participant_alive)
+{
+    eprosima::fastdds::dds::WireProtocolConfigQos wire_protocol;
+    wire_protocol.builtin.discovery_config.leaseDuration = Duration_t(1, 0);
+    wire_protocol.builtin.discovery_config.leaseDuration_announcementperiod = Duration_t(0, 100000000);
+
+    PubSubParticipant<HelloWorldPubSubType> participant_1(0u, 0u, 0u, 0u);
+    ASSERT_TRUE(participant_1.wire_protocol(wire_protocol).user_data({'a', 'b'}).init_participant());
+
+    std::atomic<uint32_t> unchanged_announcements{0};
+    PubSubParticipant<HelloWorldPubSubType> participant_2(0u, 0u, 0u, 0u);
+    participant_2.set_on_participant_qos_update_function([&](const rtps::ParticipantDiscoveryInfo& info) -> bool
+            {
+                if (info.info.m_userData == std::vector<rtps::octet>({'a', 'b'}))
+                {
+                    ++unchanged_announcements;
+                    return false;
+                }
+                return info.info.m_userData == std::vector<rtps::octet>({'c', 'd'});
+            });
+    ASSERT_TRUE(participant_2.init_participant());
+
+    participant_1.wait_discovery();
+    participant_2.wait_discovery();
+
+    // Let several leases expire if the unchanged announcements were not processed
+    std::this_thread::sleep_for(std::chrono::seconds(3));
+    EXPECT_TRUE(participant_2.wait_discovery(std::chrono::seconds(1), 1, true));
+    EXPECT_GT(unchanged_announcements.load(), 0u);
+
+    // Update user data
+    ASSERT_TRUE(participant_1.update_user_data({'c', 'd'}));
+
+    participant_2.wait_qos_update();
+    EXPECT_TRUE(participant_2.wait_discovery(std::chrono::seconds(1), 1, true));
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
@@ -20,6 +20,8 @@
 #include <memory>
 #include <gmock/gmock.h>
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
 /**
  * eProsima log mock.
  */
@@ -82,6 +84,11 @@ public:
         ClearConsumersFunc();
     }
 
+    static void SetThreadConfig(
+            const rtps::ThreadSettings&)
+    {
+    }
+
 };
 
 using ::testing::_;
@@ -26,6 +26,7 @@
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/writer/RTPSWriter.h>
+#include <rtps/messages/RTPSMessageGroup_t.hpp>
 
 #if HAVE_SECURITY
 #include <rtps/security/SecurityManager.h>
@@ -35,6 +36,7 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 #include <sstream>
 
 namespace eprosima {
@@ -269,6 +271,21 @@ public:
         return 65536;
     }
 
+    std::unique_ptr<RTPSMessageGroup_t> get_send_buffer()
+    {
+        return std::unique_ptr<RTPSMessageGroup_t>(new RTPSMessageGroup_t(
+#if HAVE_SECURITY
+                           false,
+#endif // if HAVE_SECURITY
+                           getMaxMessageSize(), GuidPrefix_t()));
+    }
+
+    void return_send_buffer(
+            std::unique_ptr <RTPSMessageGroup_t>&& buffer)
+    {
+        buffer.reset();
+    }
+
     const RTPSParticipantAttributes& getRTPSParticipantAttributes() const
     {
         return attr_;
@@ -100,6 +100,16 @@ public:
 
 #endif // FASTDDS_STATISTICS
 
+    void on_acknack(
+            int32_t /*count*/)
+    {
+    }
+
+    void on_nackfrag(
+            int32_t /*count*/)
+    {
+    }
+
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD1(change_removed_by_history, bool(CacheChange_t* change));
 
@@ -112,6 +112,10 @@ public:
 
 #endif // FASTDDS_STATISTICS
 
+    void on_gap()
+    {
+    }
+
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD3(new_change, CacheChange_t* (
             const std::function<uint32_t()>&,
@@ -259,6 +263,21 @@ public:
         return async_locator_selector_;
     }
 
+    bool begin_sample_batch_nts(
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+    {
+        return false;
+    }
+
+    void end_sample_batch_nts()
+    {
+    }
+
+    RTPSMessageGroup* sample_batch_group_nts() const
+    {
+        return nullptr;
+    }
+
     WriterHistory* history_;
 
     WriterListener* listener_;
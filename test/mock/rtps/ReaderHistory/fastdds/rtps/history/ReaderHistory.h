@@ -23,6 +23,7 @@
 #include <fastrtps/rtps/attributes/HistoryAttributes.h>
 #include <fastdds/dds/core/status/SampleRejectedStatus.hpp>
 #include <fastrtps/utils/TimedMutex.hpp>
+#include <fastrtps/utils/collections/RingBuffer.hpp>
 
 #include <mutex>
 
@@ -41,8 +42,9 @@ class ReaderHistory
 
 public:
 
-    using iterator = std::vector<CacheChange_t*>::iterator;
-    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
+    using changes_collection = RingBuffer<CacheChange_t*>;
+    using iterator = changes_collection::iterator;
+    using const_iterator = changes_collection::const_iterator;
 
     ReaderHistory(
             const HistoryAttributes& /*att*/)
@@ -181,7 +183,7 @@ protected:
 
     RTPSReader* mp_reader;
     RecursiveTimedMutex* mp_mutex;
-    std::vector<CacheChange_t*> m_changes;
+    changes_collection m_changes;
     bool m_isHistoryFull;
     std::mutex samples_number_mutex_;
     unsigned int samples_number_;
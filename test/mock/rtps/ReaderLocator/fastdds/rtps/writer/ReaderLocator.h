@@ -91,21 +91,23 @@ public:
      * @return false when this object was already started, true otherwise.
      */
     bool start(
-            const GUID_t& /*remote_guid*/,
+            const GUID_t& remote_guid,
             const ResourceLimitedVector<Locator_t>& /*unicast_locators*/,
             const ResourceLimitedVector<Locator_t>& /*multicast_locators*/,
             bool /*expects_inline_qos*/)
     {
+        remote_guid_ = remote_guid;
         return true;
     }
 
     bool start(
-            const GUID_t& /*remote_guid*/,
+            const GUID_t& remote_guid,
             const ResourceLimitedVector<Locator_t>& /*unicast_locators*/,
             const ResourceLimitedVector<Locator_t>& /*multicast_locators*/,
             bool /*expects_inline_qos*/,
             bool /*is_datasharing*/)
     {
+        remote_guid_ = remote_guid;
         return true;
     }
 
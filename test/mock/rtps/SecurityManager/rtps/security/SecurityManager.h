@@ -20,6 +20,8 @@
 
 #include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
 #include <fastrtps/rtps/builtin/data/WriterProxyData.h>
+#include <fastrtps/rtps/common/CDRMessage_t.h>
+#include <fastrtps/rtps/common/SerializedPayload.h>
 
 #include <gmock/gmock.h>
 
@@ -54,6 +56,28 @@ public:
                 const GUID_t& reader_guid,
                 const GUID_t& remote_participant,
                 const GUID_t& remote_writer_guid));
+
+    MOCK_CONST_METHOD3(encode_rtps_message, bool(
+                const CDRMessage_t& input_message,
+                CDRMessage_t& output_message,
+                const std::vector<GuidPrefix_t>& receiving_list));
+
+    MOCK_CONST_METHOD4(encode_writer_submessage, bool(
+                const CDRMessage_t& input_message,
+                CDRMessage_t& output_message,
+                const GUID_t& writer_guid,
+                const std::vector<GUID_t>& receiving_list));
+
+    MOCK_CONST_METHOD4(encode_reader_submessage, bool(
+                const CDRMessage_t& input_message,
+                CDRMessage_t& output_message,
+                const GUID_t& reader_guid,
+                const std::vector<GUID_t>& receiving_list));
+
+    MOCK_CONST_METHOD3(encode_serialized_payload, bool(
+                const SerializedPayload_t& payload,
+                SerializedPayload_t& output_payload,
+                const GUID_t& writer_guid));
     // *INDENT-ON*
 };
 
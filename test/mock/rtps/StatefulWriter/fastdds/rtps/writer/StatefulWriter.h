@@ -113,6 +113,16 @@ public:
         return false;
     }
 
+    uint64_t acknowledgement_generation() const
+    {
+        return acknowledgement_generation_;
+    }
+
+    WriterHistory* history() const
+    {
+        return mp_history;
+    }
+
 private:
 
     friend class ReaderProxy;
@@ -123,6 +133,8 @@ private:
 
     fastdds::rtps::IReaderDataFilter* reader_data_filter_;
 
+    uint64_t acknowledgement_generation_ = 0;
+
 };
 
 } // namespace rtps
@@ -24,6 +24,7 @@
 #include <fastrtps/rtps/common/CacheChange.h>
 #include <fastrtps/rtps/attributes/HistoryAttributes.h>
 #include <fastrtps/utils/TimedMutex.hpp>
+#include <fastrtps/utils/collections/RingBuffer.hpp>
 #include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 
 #include <gmock/gmock.h>
@@ -50,7 +51,10 @@ public:
     {
     }
 
-    using iterator = std::vector<CacheChange_t*>::iterator;
+    using changes_collection = RingBuffer<CacheChange_t*>;
+    using iterator = changes_collection::iterator;
+    using reverse_iterator = changes_collection::reverse_iterator;
+    using const_iterator = changes_collection::const_iterator;
 
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD1(add_change_mock, bool(CacheChange_t*));
@@ -83,6 +87,8 @@ public:
 
     MOCK_METHOD1(remove_change_mock, bool(CacheChange_t*));
 
+    MOCK_METHOD2(remove_change, iterator(const_iterator, bool));
+
     MOCK_METHOD0(getHistorySize, size_t());
 
     MOCK_METHOD0(remove_min_change, bool());
@@ -144,22 +150,22 @@ public:
         return last_sequence_number_ + 1;
     }
 
-    std::vector<CacheChange_t*>::iterator changesBegin()
+    iterator changesBegin()
     {
         return m_changes.begin();
     }
 
-    std::vector<CacheChange_t*>::reverse_iterator changesRbegin()
+    reverse_iterator changesRbegin()
     {
         return m_changes.rbegin();
     }
 
-    std::vector<CacheChange_t*>::iterator changesEnd()
+    iterator changesEnd()
     {
         return m_changes.end();
     }
 
-    std::vector<CacheChange_t*>::reverse_iterator changesRend()
+    reverse_iterator changesRend()
     {
         return m_changes.rend();
     }
@@ -170,7 +176,7 @@ public:
     }
 
     HistoryAttributes m_att;
-    std::vector<CacheChange_t*> m_changes;
+    changes_collection m_changes;
 
     std::condition_variable samples_number_cond_;
     std::mutex samples_number_mutex_;
@@ -0,0 +1,135 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DynamicDataViewTest.cpp
+ *
+ * Compares the time needed to read the header of a large dynamic sample (about 100 KB) when it is fully
+ * deserialized with DynamicPubSubType, and when it is accessed through a DynamicDataView.
+ *
+ * Usage: DynamicDataViewTest [iterations]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicDataView.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::types;
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr uint32_t num_values = 12800;
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 1000;
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (0 == iterations)
+    {
+        std::cerr << "Usage: " << argv[0] << " [iterations]" << std::endl;
+        return 1;
+    }
+
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder_ptr float64_builder = factory->create_float64_builder();
+    DynamicTypeBuilder_ptr values_builder = factory->create_sequence_builder(float64_builder.get(), num_values);
+    DynamicTypeBuilder_ptr sample_builder = factory->create_struct_builder();
+    sample_builder->add_member(0, "id", factory->create_int32_type());
+    sample_builder->add_member(1, "stamp", factory->create_uint64_type());
+    sample_builder->add_member(2, "source", factory->create_string_type());
+    sample_builder->add_member(3, "values", values_builder->build());
+    sample_builder->add_member(4, "checksum", factory->create_uint32_type());
+    DynamicType_ptr sample_type = sample_builder->build();
+
+    DynamicData* sample = DynamicDataFactory::get_instance()->create_data(sample_type);
+    sample->set_int32_value(7, 0);
+    sample->set_uint64_value(123456789u, 1);
+    sample->set_string_value("sensor", 2);
+    DynamicData* values = sample->loan_value(3);
+    for (uint32_t i = 0; i < num_values; ++i)
+    {
+        MemberId id;
+        values->insert_sequence_data(id);
+        values->set_float64_value(i * 0.5, id);
+    }
+    sample->return_loaned_value(values);
+    sample->set_uint32_value(0xCAFEu, 4);
+
+    DynamicPubSubType pubsub_type(sample_type);
+    rtps::SerializedPayload_t payload(static_cast<uint32_t>(pubsub_type.getSerializedSizeProvider(sample)()));
+    if (!pubsub_type.serialize(sample, &payload))
+    {
+        std::cerr << "Error serializing sample" << std::endl;
+        return 1;
+    }
+
+    // Full deserialization
+    DynamicData* received = DynamicDataFactory::get_instance()->create_data(sample_type);
+    uint64_t deserialize_sum = 0;
+    Clock::time_point start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        pubsub_type.deserialize(&payload, received);
+        int32_t id = 0;
+        uint32_t checksum = 0;
+        received->get_int32_value(id, 0);
+        received->get_uint32_value(checksum, 4);
+        deserialize_sum += static_cast<uint64_t>(id) + checksum;
+    }
+    auto deserialize_time = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+    // Lazy access
+    DynamicDataView view(sample_type);
+    uint64_t view_sum = 0;
+    start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        view.bind(payload);
+        int32_t id = 0;
+        uint32_t checksum = 0;
+        view.get_int32_value(id, 0);
+        view.get_uint32_value(checksum, 4);
+        view_sum += static_cast<uint64_t>(id) + checksum;
+    }
+    auto view_time = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+    DynamicDataFactory::get_instance()->delete_data(received);
+    DynamicDataFactory::get_instance()->delete_data(sample);
+
+    std::cout << "Sample size: " << payload.length << " bytes, iterations: " << iterations << std::endl;
+    std::cout << "deserialize: " << deserialize_time.count() / iterations << " ns/sample" << std::endl;
+    std::cout << "view:        " << view_time.count() / iterations << " ns/sample" << std::endl;
+
+    if (deserialize_sum != view_sum)
+    {
+        std::cerr << "Values read through the view do not match the deserialized ones" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -16,6 +16,23 @@ import argparse
 import os
 import subprocess
 
+try:
+    import resource
+except ImportError:
+    # Not available on Windows
+    resource = None
+
+
+def print_cpu_usage():
+    """Print the CPU time consumed by the finished test processes."""
+    if resource:
+        usage = resource.getrusage(resource.RUSAGE_CHILDREN)
+        print('CPU time: user {:.3f} s, system {:.3f} s'.format(
+            usage.ru_utime, usage.ru_stime),
+            flush=True
+        )
+
+
 if __name__ == '__main__':
     parser = argparse.ArgumentParser(
         formatter_class=argparse.ArgumentDefaultsHelpFormatter
@@ -250,6 +267,7 @@ if __name__ == '__main__':
         # Wait until finish
         subscriber.communicate()
         publisher.communicate()
+        print_cpu_usage()
 
         if subscriber.returncode != 0:
             exit(subscriber.returncode)
@@ -295,5 +313,6 @@ if __name__ == '__main__':
         both = subprocess.Popen(command)
         # Wait until finish
         both.communicate()
+        print_cpu_usage()
         exit(both.returncode)
     exit(0)
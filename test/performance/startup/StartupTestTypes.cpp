@@ -0,0 +1,66 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StartupTestTypes.cpp
+ *
+ */
+
+#include "StartupTestTypes.hpp"
+
+#include <cstring>
+
+using namespace eprosima::fastrtps::rtps;
+
+bool StartupDataType::serialize(
+        void* data,
+        SerializedPayload_t* payload)
+{
+    static uint8_t encapsulation[4] = { 0x0, 0x1, 0x0, 0x0 };
+
+    memcpy(payload->data, encapsulation, SerializedPayload_t::representation_header_size);
+    memcpy(payload->data + SerializedPayload_t::representation_header_size, data, sizeof(StartupType));
+    payload->length = m_typeSize;
+    return true;
+}
+
+bool StartupDataType::deserialize(
+        SerializedPayload_t* payload,
+        void* data)
+{
+    // Payload members endianness matches local machine
+    memcpy(data, payload->data + SerializedPayload_t::representation_header_size, sizeof(StartupType));
+    return true;
+}
+
+std::function<uint32_t()> StartupDataType::getSerializedSizeProvider(
+        void*)
+{
+    uint32_t size = m_typeSize;
+    return [size]() -> uint32_t
+           {
+               return size;
+           };
+}
+
+void* StartupDataType::createData()
+{
+    return new StartupType();
+}
+
+void StartupDataType::deleteData(
+        void* data)
+{
+    delete static_cast<StartupType*>(data);
+}
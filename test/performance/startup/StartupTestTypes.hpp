@@ -0,0 +1,94 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StartupTestTypes.hpp
+ *
+ */
+
+#ifndef STARTUPTESTTYPES_HPP_
+#define STARTUPTESTTYPES_HPP_
+
+#include <cstdint>
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+
+/*
+ * Small plain sample. The startup test only measures the time until the first one is delivered, so its content
+ * is irrelevant.
+ */
+struct StartupType
+{
+    // identifies the sample sent
+    uint32_t seqnum = 0;
+    // actual payload
+    uint8_t data[60] = {};
+};
+
+class StartupDataType : public eprosima::fastdds::dds::TopicDataType
+{
+public:
+
+    StartupDataType()
+    {
+        setName("StartupType");
+        m_typeSize = sizeof(StartupType) + eprosima::fastrtps::rtps::SerializedPayload_t::representation_header_size;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+    bool deserialize(
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override;
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override;
+
+    void* createData() override;
+
+    void deleteData(
+            void* data) override;
+
+    bool getKey(
+            void* /*data*/,
+            eprosima::fastrtps::rtps::InstanceHandle_t* /*ihandle*/,
+            bool force_md5 = false) override
+    {
+        (void)force_md5;
+        return false;
+    }
+
+    bool is_bounded() const override
+    {
+        return true;
+    }
+
+    bool is_plain() const override
+    {
+        return true;
+    }
+
+    bool construct_sample(
+            void* sample) const override
+    {
+        new (sample) StartupType();
+        return true;
+    }
+
+};
+
+#endif /* STARTUPTESTTYPES_HPP_ */
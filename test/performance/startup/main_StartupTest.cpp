@@ -0,0 +1,518 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_StartupTest.cpp
+ *
+ * Measures how long it takes for a process to be able to communicate:
+ *   - xml: loading the XML profiles file (if any).
+ *   - participant: creating (and enabling) the DomainParticipant.
+ *   - endpoints: registering the type and creating the topic and the DataWriter or DataReader.
+ *   - match: since the start of the process until the first remote endpoint is matched.
+ *   - first_sample: since the start of the process until the first sample is acknowledged (publisher) or
+ *     received (subscriber).
+ */
+
+#include "StartupTestTypes.hpp"
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/DataWriterListener.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+using namespace eprosima::fastdds::dds;
+
+using Clock = std::chrono::steady_clock;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    XML_FILE,
+    FORCED_DOMAIN,
+    TOPIC,
+    TIMEOUT,
+    EXPORT_CSV,
+    PHASES
+};
+
+enum TestAgent
+{
+    PUBLISHER,
+    SUBSCRIBER,
+    BOTH
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT,     0, "",  "",                Arg::None,
+      "Usage: StartupTest <publisher|subscriber|both>\n\nGeneral options:" },
+    { HELP,            0, "h", "help",            Arg::None,
+      "  -h           --help                Produce help message." },
+    { XML_FILE,        0, "",  "xml",             Arg::String,
+      "               --xml                 XML Configuration file." },
+    { FORCED_DOMAIN,   0, "",  "domain",          Arg::Numeric,
+      "               --domain              DDS Domain (defaults to 0)." },
+    { TOPIC,           0, "",  "topic",           Arg::String,
+      "               --topic               Topic name (defaults to \"StartupTest\")." },
+    { TIMEOUT,         0, "",  "timeout",         Arg::Numeric,
+      "               --timeout             Milliseconds to wait for the match and the first sample "
+      "(defaults to 10000)." },
+    { EXPORT_CSV,      0, "",  "export_csv",      Arg::None,
+      "               --export_csv          Print the results as a CSV line "
+      "(role,xml,participant,endpoints,match,first_sample)." },
+    { PHASES,          0, "",  "phases",          Arg::None,
+      "               --phases              Print the startup phases measured inside the library. "
+      "Requires a library with info messages compiled in." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+/**
+ * Times measured for one role, in microseconds. Negative values mean the step did not happen.
+ */
+struct StartupTimes
+{
+    int64_t xml = 0;
+    int64_t participant = -1;
+    int64_t endpoints = -1;
+    int64_t match = -1;
+    int64_t first_sample = -1;
+};
+
+static int64_t elapsed_us(
+        const Clock::time_point& since)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - since).count();
+}
+
+/**
+ * One participant with a single endpoint, either publishing or subscribing.
+ */
+class StartupTestAgent : public DataWriterListener, public DataReaderListener
+{
+public:
+
+    StartupTestAgent(
+            bool publisher,
+            const Clock::time_point& process_start)
+        : publisher_(publisher)
+        , process_start_(process_start)
+        , type_(new StartupDataType())
+    {
+    }
+
+    ~StartupTestAgent()
+    {
+        if (nullptr != participant_)
+        {
+            participant_->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant_);
+        }
+    }
+
+    const char* role() const
+    {
+        return publisher_ ? "publisher" : "subscriber";
+    }
+
+    bool init(
+            DomainId_t domain,
+            const std::string& topic_name)
+    {
+        Clock::time_point start = Clock::now();
+        participant_ = DomainParticipantFactory::get_instance()->create_participant(domain, PARTICIPANT_QOS_DEFAULT);
+        if (nullptr == participant_)
+        {
+            std::cout << "Error creating the participant" << std::endl;
+            return false;
+        }
+        times_.participant = elapsed_us(start);
+
+        start = Clock::now();
+        type_.register_type(participant_);
+        Topic* topic = participant_->create_topic(topic_name, type_.get_type_name(), TOPIC_QOS_DEFAULT);
+        if (nullptr == topic)
+        {
+            std::cout << "Error creating the topic" << std::endl;
+            return false;
+        }
+
+        if (publisher_)
+        {
+            DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+            qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+            qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+            Publisher* publisher = participant_->create_publisher(PUBLISHER_QOS_DEFAULT);
+            writer_ = (nullptr == publisher) ? nullptr : publisher->create_datawriter(topic, qos, this);
+            if (nullptr == writer_)
+            {
+                std::cout << "Error creating the DataWriter" << std::endl;
+                return false;
+            }
+        }
+        else
+        {
+            DataReaderQos qos = DATAREADER_QOS_DEFAULT;
+            qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+            qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+            Subscriber* subscriber = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+            reader_ = (nullptr == subscriber) ? nullptr : subscriber->create_datareader(topic, qos, this);
+            if (nullptr == reader_)
+            {
+                std::cout << "Error creating the DataReader" << std::endl;
+                return false;
+            }
+        }
+        times_.endpoints = elapsed_us(start);
+
+        if (publisher_)
+        {
+            // Durability is transient local, so the sample reaches the reader as soon as it is matched
+            StartupType sample;
+            sample.seqnum = 1;
+            if (!writer_->write(&sample))
+            {
+                std::cout << "Error writing the sample" << std::endl;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Wait for the first match and the first sample.
+     * @return true if both happened before the timeout.
+     */
+    bool wait(
+            const std::chrono::milliseconds& timeout)
+    {
+        Clock::time_point deadline = Clock::now() + timeout;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!cv_.wait_until(lock, deadline, [this]()
+                    {
+                        return times_.match >= 0;
+                    }))
+            {
+                std::cout << role() << " timed out waiting for a match" << std::endl;
+                return false;
+            }
+        }
+
+        if (publisher_)
+        {
+            auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - Clock::now());
+            if (remaining.count() <= 0 ||
+                    ReturnCode_t::RETCODE_OK != writer_->wait_for_acknowledgments(
+                        eprosima::fastrtps::Duration_t(static_cast<long double>(remaining.count()) / 1e9)))
+            {
+                std::cout << role() << " timed out waiting for the acknowledgment" << std::endl;
+                return false;
+            }
+            times_.first_sample = elapsed_us(process_start_);
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cv_.wait_until(lock, deadline, [this]()
+                {
+                    return times_.first_sample >= 0;
+                }))
+        {
+            std::cout << role() << " timed out waiting for the first sample" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    StartupTimes& times()
+    {
+        return times_;
+    }
+
+    void on_publication_matched(
+            DataWriter* /*writer*/,
+            const PublicationMatchedStatus& info) override
+    {
+        if (0 < info.current_count_change)
+        {
+            matched();
+        }
+    }
+
+    void on_subscription_matched(
+            DataReader* /*reader*/,
+            const SubscriptionMatchedStatus& info) override
+    {
+        if (0 < info.current_count_change)
+        {
+            matched();
+        }
+    }
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        StartupType sample;
+        SampleInfo info;
+        while (ReturnCode_t::RETCODE_OK == reader->take_next_sample(&sample, &info))
+        {
+            if (info.valid_data)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (times_.first_sample < 0)
+                {
+                    times_.first_sample = elapsed_us(process_start_);
+                    cv_.notify_all();
+                }
+            }
+        }
+    }
+
+private:
+
+    void matched()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (times_.match < 0)
+        {
+            times_.match = elapsed_us(process_start_);
+            cv_.notify_all();
+        }
+    }
+
+    bool publisher_;
+
+    Clock::time_point process_start_;
+
+    TypeSupport type_;
+
+    DomainParticipant* participant_ = nullptr;
+
+    DataWriter* writer_ = nullptr;
+
+    DataReader* reader_ = nullptr;
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    StartupTimes times_;
+};
+
+static void print_times(
+        const char* role,
+        const StartupTimes& times,
+        bool export_csv)
+{
+    if (export_csv)
+    {
+        std::cout << role << "," << times.xml << "," << times.participant << "," << times.endpoints << ","
+                  << times.match << "," << times.first_sample << std::endl;
+    }
+    else
+    {
+        std::cout << "StartupTest " << role << " (us): xml=" << times.xml << " participant=" << times.participant
+                  << " endpoints=" << times.endpoints << " match=" << times.match
+                  << " first_sample=" << times.first_sample << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    // Every measurement is relative to this point
+    Clock::time_point process_start = Clock::now();
+
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif // if defined(_WIN32)
+
+    TestAgent test_agent = TestAgent::PUBLISHER;
+    std::string xml_config_file = "";
+    DomainId_t domain = 0;
+    std::string topic_name = "StartupTest";
+    uint32_t timeout_ms = 10000;
+    bool export_csv = false;
+    bool phases = false;
+
+    argc -= (argc > 0);
+    argv += (argc > 0); // skip program name argv[0] if present
+    if (argc > 0)
+    {
+        if (strcmp(argv[0], "publisher") == 0)
+        {
+            test_agent = TestAgent::PUBLISHER;
+        }
+        else if (strcmp(argv[0], "subscriber") == 0)
+        {
+            test_agent = TestAgent::SUBSCRIBER;
+        }
+        else if (strcmp(argv[0], "both") == 0)
+        {
+            test_agent = TestAgent::BOTH;
+        }
+        else
+        {
+            option::printUsage(fwrite, stdout, usage, columns);
+            return 0;
+        }
+    }
+    else
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    argc -= (argc > 0); argv += (argc > 0); // skip pub/sub argument
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case XML_FILE:
+                xml_config_file = opt.arg;
+                break;
+            case FORCED_DOMAIN:
+                domain = static_cast<DomainId_t>(strtol(opt.arg, nullptr, 10));
+                break;
+            case TOPIC:
+                topic_name = opt.arg;
+                break;
+            case TIMEOUT:
+                timeout_ms = static_cast<uint32_t>(strtoul(opt.arg, nullptr, 10));
+                break;
+            case EXPORT_CSV:
+                export_csv = true;
+                break;
+            case PHASES:
+                phases = true;
+                break;
+            case UNKNOWN_OPT:
+            default:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 0;
+                break;
+        }
+    }
+
+    if (phases)
+    {
+        Log::SetVerbosity(Log::Kind::Info);
+        Log::SetCategoryFilter(std::regex("STARTUP"));
+    }
+
+    // Load an XML file with predefined profiles for publisher and subscriber
+    int64_t xml_time = 0;
+    if (xml_config_file.length() > 0)
+    {
+        Clock::time_point start = Clock::now();
+        if (ReturnCode_t::RETCODE_OK !=
+                DomainParticipantFactory::get_instance()->load_XML_profiles_file(xml_config_file))
+        {
+            std::cout << "Error loading XML file " << xml_config_file << std::endl;
+            return 1;
+        }
+        xml_time = elapsed_us(start);
+    }
+
+    std::vector<std::unique_ptr<StartupTestAgent>> agents;
+    if (TestAgent::SUBSCRIBER != test_agent)
+    {
+        agents.emplace_back(new StartupTestAgent(true, process_start));
+    }
+    if (TestAgent::PUBLISHER != test_agent)
+    {
+        agents.emplace_back(new StartupTestAgent(false, process_start));
+    }
+
+    bool result = true;
+    for (auto& agent : agents)
+    {
+        agent->times().xml = xml_time;
+        result = result && agent->init(domain, topic_name);
+    }
+
+    for (auto& agent : agents)
+    {
+        result = result && agent->wait(std::chrono::milliseconds(timeout_ms));
+    }
+
+    for (auto& agent : agents)
+    {
+        print_times(agent->role(), agent->times(), export_csv);
+    }
+
+    agents.clear();
+    Log::Flush();
+    Log::Reset();
+
+    return result ? 0 : 1;
+}
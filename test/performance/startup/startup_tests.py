@@ -0,0 +1,166 @@
+# Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import os
+import statistics
+import subprocess
+
+METRICS = ['xml', 'participant', 'endpoints', 'match', 'first_sample']
+
+
+def parse_results(output, results):
+    """Accumulate the CSV lines printed by StartupTest into results."""
+    for line in output.splitlines():
+        fields = line.strip().split(',')
+        if len(fields) != len(METRICS) + 1 or fields[0] not in ('publisher', 'subscriber'):
+            continue
+        role = fields[0]
+        if role not in results:
+            results[role] = {metric: [] for metric in METRICS}
+        for metric, value in zip(METRICS, fields[1:]):
+            results[role][metric].append(int(value))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter
+    )
+    parser.add_argument(
+        '-x',
+        '--xml_file',
+        help='A Fast-DDS XML configuration file',
+        required=False
+    )
+    parser.add_argument(
+        '-n',
+        '--number_of_runs',
+        help='The number of times the startup is measured',
+        required=False,
+        default='10'
+    )
+    parser.add_argument(
+        '-i',
+        '--interprocess',
+        action='store_true',
+        help='Publisher and subscriber in separate processes. Defaults:False',
+        required=False
+    )
+    parser.add_argument(
+        '-p',
+        '--phases',
+        action='store_true',
+        help='Print the startup phases measured inside the library. Defaults:False',
+        required=False
+    )
+
+    # Parse arguments
+    args = parser.parse_args()
+
+    # Check that runs is positive
+    if str.isdigit(args.number_of_runs) and int(args.number_of_runs) > 0:
+        runs = int(args.number_of_runs)
+    else:
+        print(
+            '"number_of_runs" must be a positive integer, NOT {}'.format(
+                args.number_of_runs
+            )
+        )
+        exit(1)  # Exit with error
+
+    # XML options
+    xml_options = []
+    if args.xml_file:
+        if not os.path.isfile(args.xml_file):
+            print('XML file "{}" is NOT a file'.format(args.xml_file))
+            exit(1)  # Exit with error
+        else:
+            xml_options = ['--xml', args.xml_file]
+
+    phases_options = ['--phases'] if args.phases else []
+
+    # Environment variables
+    executable = os.environ.get('STARTUP_TEST_BIN')
+
+    # Check that executable exists
+    if executable:
+        if not os.path.isfile(executable):
+            print('STARTUP_TEST_BIN does NOT specify a file')
+            exit(1)  # Exit with error
+    else:
+        print('STARTUP_TEST_BIN is NOT set')
+        exit(1)  # Exit with error
+
+    # Domain
+    domain = str(os.getpid() % 230)
+    common_options = ['--domain', domain, '--export_csv']
+    common_options += xml_options
+    common_options += phases_options
+
+    results = {}
+    for run in range(runs):
+        # Each run uses its own topic, so samples from a previous run cannot be received
+        run_options = common_options + ['--topic', 'StartupTest_{}_{}'.format(os.getpid(), run)]
+
+        if args.interprocess is True:
+            pub_command = [executable, 'publisher'] + run_options
+            sub_command = [executable, 'subscriber'] + run_options
+
+            if 0 == run:
+                print('Publisher command: {}'.format(' '.join(pub_command)), flush=True)
+                print('Subscriber command: {}'.format(' '.join(sub_command)), flush=True)
+
+            # Spawn processes
+            subscriber = subprocess.Popen(sub_command, stdout=subprocess.PIPE, universal_newlines=True)
+            publisher = subprocess.Popen(pub_command, stdout=subprocess.PIPE, universal_newlines=True)
+            # Wait until finish
+            sub_output, _ = subscriber.communicate()
+            pub_output, _ = publisher.communicate()
+            outputs = [sub_output, pub_output]
+            return_codes = [subscriber.returncode, publisher.returncode]
+        else:
+            command = [executable, 'both'] + run_options
+
+            if 0 == run:
+                print('Executable command: {}'.format(' '.join(command)), flush=True)
+
+            # Spawn process
+            both = subprocess.Popen(command, stdout=subprocess.PIPE, universal_newlines=True)
+            # Wait until finish
+            output, _ = both.communicate()
+            outputs = [output]
+            return_codes = [both.returncode]
+
+        for output in outputs:
+            if args.phases:
+                print(output, flush=True)
+            parse_results(output, results)
+
+        for return_code in return_codes:
+            if return_code != 0:
+                print('Run {} failed'.format(run))
+                for output in outputs:
+                    print(output)
+                exit(return_code)
+
+    # Summary
+    print('Startup times (us) over {} runs'.format(runs))
+    print('{:<12}{:<14}{:>12}{:>12}{:>12}'.format('role', 'metric', 'min', 'median', 'max'))
+    for role in sorted(results):
+        for metric in METRICS:
+            values = results[role][metric]
+            print('{:<12}{:<14}{:>12}{:>12}{:>12}'.format(
+                role, metric, min(values), int(statistics.median(values)), max(values)))
+
+    exit(0)
@@ -0,0 +1,198 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_WritePathTest.cpp
+ *
+ * Measures the throughput of DataWriter::write, without matched readers, for the Benchmark_medium and
+ * Benchmark_big example types, which are bounded, and for the unbounded HelloWorld example type, on each history
+ * memory policy. HelloWorld samples carry a large message once every few samples, so the serialized size hint of
+ * unbounded types both grows and decays. HelloWorld is measured twice, with and without declaring that its
+ * serialization checks the payload bounds, as only types that do use the serialized size hint.
+ *
+ * Usage: WritePathTest [iterations]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include "Benchmark_big.h"
+#include "Benchmark_bigPubSubTypes.h"
+#include "Benchmark_medium.h"
+#include "Benchmark_mediumPubSubTypes.h"
+#include "HelloWorld.h"
+#include "HelloWorldPubSubTypes.h"
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+
+using Clock = std::chrono::steady_clock;
+
+//! The generated serialization returns false when the payload is too small for the sample
+class BoundsCheckedHelloWorldPubSubType : public HelloWorldPubSubType
+{
+public:
+
+    BoundsCheckedHelloWorldPubSubType()
+    {
+        setName("BoundsCheckedHelloWorld");
+    }
+
+    bool serialize_checks_bounds() const override
+    {
+        return true;
+    }
+
+};
+
+template<typename Sample>
+static bool run_test(
+        DomainParticipant* participant,
+        TypeSupport type,
+        MemoryManagementPolicy_t policy,
+        const std::string& policy_name,
+        uint32_t iterations,
+        const std::function<void(Sample&, uint32_t)>& prepare_sample)
+{
+    type.register_type(participant);
+    Topic* topic = participant->create_topic(type.get_type_name(), type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    qos.history().depth = 1;
+    qos.endpoint().history_memory_policy = policy;
+    DataWriter* writer = publisher->create_datawriter(topic, qos);
+    if (nullptr == writer)
+    {
+        std::cerr << "Error creating writer for " << type.get_type_name() << std::endl;
+        return false;
+    }
+
+    std::unique_ptr<Sample> sample(new Sample());
+    bool ret = true;
+    Clock::time_point start = Clock::now();
+    for (uint32_t i = 0; i < iterations && ret; ++i)
+    {
+        prepare_sample(*sample, i);
+        ret = ReturnCode_t::RETCODE_OK == writer->write(sample.get(), HANDLE_NIL);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+
+    if (ret)
+    {
+        double seconds = static_cast<double>(elapsed.count()) * 1e-6;
+        double samples_per_second = seconds > 0 ? iterations / seconds : 0;
+        std::cout << type.get_type_name() << " " << policy_name << ": " << samples_per_second << " samples/s";
+        if (type->is_bounded())
+        {
+            std::cout << ", " << samples_per_second * type->m_typeSize / (1024 * 1024) << " MB/s";
+        }
+        std::cout << std::endl;
+    }
+    else
+    {
+        std::cerr << "Error writing " << type.get_type_name() << std::endl;
+    }
+
+    publisher->delete_datawriter(writer);
+    participant->delete_publisher(publisher);
+    participant->delete_topic(topic);
+    participant->unregister_type(type.get_type_name());
+    return ret;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 1000;
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (0 == iterations)
+    {
+        std::cerr << "Usage: " << argv[0] << " [iterations]" << std::endl;
+        return 1;
+    }
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    const std::pair<MemoryManagementPolicy_t, const char*> policies[] =
+    {
+        {PREALLOCATED_MEMORY_MODE, "PREALLOCATED"},
+        {PREALLOCATED_WITH_REALLOC_MEMORY_MODE, "PREALLOCATED_WITH_REALLOC"},
+        {DYNAMIC_RESERVE_MEMORY_MODE, "DYNAMIC_RESERVE"},
+        {DYNAMIC_REUSABLE_MEMORY_MODE, "DYNAMIC_REUSABLE"}
+    };
+
+    const std::string short_message = "HelloWorld";
+    const std::string long_message(4096, 'A');
+
+    bool ret = true;
+    for (const auto& policy : policies)
+    {
+        ret &= run_test<BenchMarkMedium>(participant, TypeSupport(new BenchMarkMediumPubSubType()),
+                        policy.first, policy.second, iterations,
+                        [](BenchMarkMedium& sample, uint32_t i)
+                        {
+                            sample.index(i);
+                        });
+        ret &= run_test<BenchMarkBig>(participant, TypeSupport(new BenchMarkBigPubSubType()),
+                        policy.first, policy.second, iterations,
+                        [](BenchMarkBig& sample, uint32_t i)
+                        {
+                            sample.index(i);
+                        });
+
+        // PREALLOCATED payloads cannot hold samples over the maximum size declared by an unbounded type
+        if (PREALLOCATED_MEMORY_MODE != policy.first)
+        {
+            auto prepare_hello_world = [&short_message, &long_message](HelloWorld& sample, uint32_t i)
+                    {
+                        sample.index(i);
+                        sample.message(0 == i % 16 ? long_message : short_message);
+                    };
+            ret &= run_test<HelloWorld>(participant, TypeSupport(new HelloWorldPubSubType()),
+                            policy.first, policy.second, iterations, prepare_hello_world);
+            ret &= run_test<HelloWorld>(participant, TypeSupport(new BoundsCheckedHelloWorldPubSubType()),
+                            policy.first, policy.second, iterations, prepare_hello_world);
+        }
+    }
+
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+    return ret ? 0 : 1;
+}
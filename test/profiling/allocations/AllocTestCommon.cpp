@@ -54,6 +54,7 @@ static std::atomic_size_t g_allocations[4];
 static std::atomic_size_t g_deallocations[4];
 
 static std::atomic_size_t g_phase(0u);
+static size_t g_data_exchange_samples = 0;
 static std::atomic<std::atomic_size_t*> g_allocationsPtr(g_allocations);
 static std::atomic<std::atomic_size_t*> g_deallocationsPtr(g_deallocations);
 
@@ -142,9 +143,11 @@ void first_sample_exchanged()
 /**
  * Called after all samples have been sent/received. Undiscovery will begin.
  */
-void all_samples_exchanged()
+void all_samples_exchanged(
+        size_t num_samples)
 {
     next_phase();
+    g_data_exchange_samples = num_samples;
 }
 
 /**
@@ -208,4 +211,32 @@ void print_results(
     outFile.close();
 }
 
+/**
+ * Check the data exchange phase has been allocation free.
+ */
+bool check_data_exchange(
+        const std::string& entity)
+{
+    if (!g_print_results)
+    {
+        std::cout << "Data exchange phase not checked: memory profiler not working" << std::endl;
+        return false;
+    }
+
+    size_t allocs = g_allocations[2].load();
+    size_t deallocs = g_deallocations[2].load();
+    // The harness uses the legacy Publisher/Subscriber API, not DataWriter/DataReader
+    const char* operation = ("publisher" == entity) ? "Publisher::write" : "Subscriber::takeNextData";
+
+    std::cout << "Data exchange phase: " << allocs << " allocations, " << deallocs << " deallocations";
+    if (g_data_exchange_samples > 0)
+    {
+        std::cout << " (" << static_cast<double>(allocs) / g_data_exchange_samples << " allocations per "
+                  << operation << " call)";
+    }
+    std::cout << std::endl;
+
+    return 0 == allocs && 0 == deallocs;
+}
+
 }   // namespace eprosima_profiling
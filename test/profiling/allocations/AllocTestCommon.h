@@ -20,6 +20,7 @@
 #ifndef FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTCOMMON_H_
 #define FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTCOMMON_H_
 
+#include <cstddef>
 #include <string>
 
 namespace eprosima_profiling
@@ -59,8 +60,12 @@ void first_sample_exchanged();
 
 /**
  * Called after all samples have been sent/received. Undiscovery will begin.
+ *
+ * @param num_samples  Number of samples sent/received during the data exchange phase.
+ *                     Used to report the number of allocations per call.
  */
-void all_samples_exchanged();
+void all_samples_exchanged(
+        size_t num_samples = 0);
 
 /**
  * Called after remote entity has been undiscovered. Memory profiling should end.
@@ -75,6 +80,18 @@ void print_results(
         const std::string& entity,
         const std::string& config);
 
+/**
+ * Check the data exchange phase has been allocation free.
+ * Per-call allocation counts are printed on the standard output.
+ *
+ * @param entity  Kind of entity being profiled (publisher or subscriber).
+ *
+ * @return false when allocations were registered on the data exchange phase, or when the memory profiler was not
+ *         working, true otherwise.
+ */
+bool check_data_exchange(
+        const std::string& entity);
+
 }   // namespace eprosima_profiling
 
 #endif   // FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTCOMMON_H_
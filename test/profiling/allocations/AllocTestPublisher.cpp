@@ -169,7 +169,7 @@ void AllocTestPublisher::run(
 
     // Flush callgrind graph
     eprosima_profiling::callgrind_dump();
-    eprosima_profiling::all_samples_exchanged();
+    eprosima_profiling::all_samples_exchanged(samples - 1);
 
     if (wait_unmatch)
     {
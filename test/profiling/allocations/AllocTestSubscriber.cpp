@@ -176,7 +176,7 @@ void AllocTestSubscriber::run(
 
     // Flush callgrind graph
     eprosima_profiling::callgrind_dump();
-    eprosima_profiling::all_samples_exchanged();
+    eprosima_profiling::all_samples_exchanged(number - 1);
 
     if (wait_unmatch)
     {
@@ -17,12 +17,15 @@
  *
  */
 
+#include "AllocTestCommon.h"
 #include "AllocTestPublisher.h"
 #include "AllocTestSubscriber.h"
 
 #include <fastrtps/Domain.h>
 #include <fastdds/dds/log/Log.hpp>
 
+#include <cstdlib>
+
 using namespace eprosima;
 using namespace fastrtps;
 using namespace rtps;
@@ -65,12 +68,17 @@ int main(int argc, char** argv)
             << "        tl_be: transient-local best-effort" << std::endl
             << "        tl_re: transient-local reliable" << std::endl
             << "        vo_be: volatile best-effort" << std::endl
-            << "        vo_re: volatile reliable" << std::endl;
+            << "        vo_re: volatile reliable" << std::endl
+            << "        vo_re_realloc: volatile reliable using PREALLOCATED_WITH_REALLOC memory policy" << std::endl;
         eprosima::fastdds::dds::Log::Reset();
         return 0;
     }
 
 
+    // When set, allocations on the data exchange phase make the test fail
+    bool strict = std::getenv("FASTDDS_PROFILING_STRICT") != nullptr;
+    int result = 0;
+
     switch(type)
     {
         case 1:
@@ -79,6 +87,14 @@ int main(int argc, char** argv)
                 if(mypub.init(profile, domain, outputFile))
                 {
                     mypub.run(60, wait_unmatch);
+                    if (!eprosima_profiling::check_data_exchange("publisher") && strict)
+                    {
+                        result = 1;
+                    }
+                }
+                else
+                {
+                    result = 2;
                 }
                 break;
             }
@@ -88,6 +104,14 @@ int main(int argc, char** argv)
                 if(mysub.init(profile, domain, outputFile))
                 {
                     mysub.run(wait_unmatch);
+                    if (!eprosima_profiling::check_data_exchange("subscriber") && strict)
+                    {
+                        result = 1;
+                    }
+                }
+                else
+                {
+                    result = 2;
                 }
                 break;
             }
@@ -96,5 +120,5 @@ int main(int argc, char** argv)
     Domain::stopAll();
     eprosima::fastdds::dds::Log::Reset();
 
-    return 0;
+    return result;
 }
@@ -0,0 +1,68 @@
+# Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Run AllocationTest for one QoS profile, profiling publisher and subscriber in turn.
+
+Usage: allocation_tests.py <profile> [domain]
+
+The profiled entity is launched with the memory_tools interpose library preloaded and
+FASTDDS_PROFILING_STRICT set, so any allocation registered after the first sample has
+been exchanged makes the test fail.
+"""
+
+import os
+import subprocess
+import sys
+import time
+
+binary = os.environ.get('ALLOCATION_TEST_BIN', './AllocationTest')
+preload = os.environ.get('ALLOCATION_TEST_PRELOAD')
+
+
+def run_profiled(entity, counterpart, profile, domain):
+    profiled_env = os.environ.copy()
+    profiled_env['FASTDDS_PROFILING_STRICT'] = '1'
+    if preload:
+        name, _, value = preload.partition('=')
+        profiled_env[name] = value
+
+    profiled = subprocess.Popen(
+        [binary, entity, profile, 'true', domain], env=profiled_env)
+    time.sleep(1)
+    other = subprocess.Popen([binary, counterpart, profile, 'false', domain])
+
+    other_ret = other.wait()
+    profiled_ret = profiled.wait()
+
+    if other_ret != 0:
+        print('Counterpart ' + counterpart + ' failed with code ' + str(other_ret))
+    if profiled_ret != 0:
+        print('Profiled ' + entity + ' failed with code ' + str(profiled_ret))
+
+    return 0 == other_ret and 0 == profiled_ret
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        print('Usage: allocation_tests.py <profile> [domain]')
+        sys.exit(1)
+
+    profile = sys.argv[1]
+    domain = sys.argv[2] if len(sys.argv) > 2 else '1'
+
+    result = run_profiled('publisher', 'subscriber', profile, domain)
+    result = run_profiled('subscriber', 'publisher', profile, domain) and result
+
+    sys.exit(0 if result else 1)
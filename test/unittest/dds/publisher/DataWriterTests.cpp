@@ -36,6 +36,7 @@
 
 #include <fastdds/publisher/DataWriterImpl.hpp>
 
+#include <cstring>
 #include <mutex>
 #include <condition_variable>
 
@@ -135,6 +136,65 @@ public:
 
 };
 
+class SizeCountingTopicDataTypeMock : public TopicDataTypeMock
+{
+public:
+
+    SizeCountingTopicDataTypeMock(
+            bool bounded,
+            bool checks_bounds)
+        : TopicDataTypeMock()
+        , bounded_(bounded)
+        , checks_bounds_(checks_bounds)
+    {
+        m_typeSize = 64u;
+        setName(bounded ? "boundedfootype" : "unboundedfootype");
+    }
+
+    bool serialize(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        const std::string& message = static_cast<FooType*>(data)->message();
+        uint32_t length = static_cast<uint32_t>(message.size()) + 4u;
+        if (payload->max_size < length)
+        {
+            return false;
+        }
+
+        memcpy(payload->data + 4, message.data(), message.size());
+        payload->length = length;
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return [this, data]()->uint32_t
+               {
+                   ++size_calls;
+                   return static_cast<uint32_t>(static_cast<FooType*>(data)->message().size()) + 4u;
+               };
+    }
+
+    bool is_bounded() const override
+    {
+        return bounded_;
+    }
+
+    bool serialize_checks_bounds() const override
+    {
+        return checks_bounds_;
+    }
+
+    uint32_t size_calls = 0;
+
+private:
+
+    bool bounded_;
+    bool checks_bounds_;
+};
+
 class InstanceFooType
 {
 public:
@@ -670,6 +730,85 @@ TEST(DataWriterTests, Write)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+/*
+ * This test checks when the serialized size of the samples is calculated:
+ * - DYNAMIC policies calculate it for every sample, so each payload is allocated with the exact size.
+ * - Bounded types on PREALLOCATED_WITH_REALLOC, which use PREALLOCATED pools, never calculate it.
+ * - Unbounded types on PREALLOCATED_WITH_REALLOC only calculate it when a sample does not fit on the size hint,
+ *   as long as their serialize checks the payload bounds. Otherwise, they calculate it for every sample.
+ */
+TEST(DataWriterTests, WriteSerializedSizeCalculation)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    const std::vector<std::string> messages = {"Hello", "Hello", "HelloWorldHelloWorldHelloWorld", "Hello"};
+
+    for (MemoryManagementPolicy_t policy : {DYNAMIC_RESERVE_MEMORY_MODE, DYNAMIC_REUSABLE_MEMORY_MODE,
+                                            PREALLOCATED_WITH_REALLOC_MEMORY_MODE})
+    {
+        DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+        qos.endpoint().history_memory_policy = policy;
+        bool is_dynamic = PREALLOCATED_WITH_REALLOC_MEMORY_MODE != policy;
+
+        for (std::pair<bool, bool> type_kind : {std::make_pair(true, true), std::make_pair(false, true),
+                                                std::make_pair(false, false)})
+        {
+            bool bounded = type_kind.first;
+            bool checks_bounds = type_kind.second;
+            SizeCountingTopicDataTypeMock* type_mock = new SizeCountingTopicDataTypeMock(bounded, checks_bounds);
+            TypeSupport type(type_mock);
+            type.register_type(participant);
+
+            Topic* topic = participant->create_topic(type.get_type_name(), type.get_type_name(), TOPIC_QOS_DEFAULT);
+            ASSERT_NE(topic, nullptr);
+
+            DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+            ASSERT_NE(datawriter, nullptr);
+
+            FooType data;
+            for (const std::string& message : messages)
+            {
+                data.message(message);
+                ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write(&data, HANDLE_NIL));
+            }
+
+            // Larger than the maximum size declared by the type
+            data.message(std::string(type_mock->m_typeSize, 'A'));
+            ReturnCode_t ret = datawriter->write(&data, HANDLE_NIL);
+
+            uint32_t num_writes = static_cast<uint32_t>(messages.size()) + 1u;
+            if (is_dynamic || !(bounded || checks_bounds))
+            {
+                EXPECT_EQ(ReturnCode_t::RETCODE_OK, ret);
+                EXPECT_EQ(num_writes, type_mock->size_calls);
+            }
+            else if (bounded)
+            {
+                EXPECT_EQ(ReturnCode_t::RETCODE_ERROR, ret);
+                EXPECT_EQ(0u, type_mock->size_calls);
+            }
+            else
+            {
+                EXPECT_EQ(ReturnCode_t::RETCODE_OK, ret);
+                EXPECT_LT(0u, type_mock->size_calls);
+                EXPECT_GT(num_writes, type_mock->size_calls);
+            }
+
+            ASSERT_EQ(ReturnCode_t::RETCODE_OK, publisher->delete_datawriter(datawriter));
+            ASSERT_EQ(ReturnCode_t::RETCODE_OK, participant->delete_topic(topic));
+            ASSERT_EQ(ReturnCode_t::RETCODE_OK, participant->unregister_type(type.get_type_name()));
+        }
+    }
+
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, participant->delete_publisher(publisher));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, DomainParticipantFactory::get_instance()->delete_participant(participant));
+}
+
 TEST(DataWriterTests, WriteWithTimestamp)
 {
     DomainParticipant* participant =
@@ -712,6 +851,44 @@ TEST(DataWriterTests, WriteWithTimestamp)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+TEST(DataWriterTests, WriteBatch)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+    ASSERT_NE(datawriter, nullptr);
+
+    FooType data[3];
+    data[0].message("Hello");
+    data[1].message("HelloWorld");
+    data[2].message("HelloWorldHelloWorld");
+
+    // 1. An empty batch writes nothing
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_batch({}));
+    // 2. A batch with an invalid sample returns RETCODE_BAD_PARAMETER
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->write_batch({&data[0], nullptr, &data[2]}));
+    // 3. Correct case
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_batch({&data[0], &data[1], &data[2]}));
+    // 4. The writer is still usable after the batch
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write(&data[0], HANDLE_NIL));
+
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, publisher->delete_datawriter(datawriter));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, participant->delete_topic(topic));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, participant->delete_publisher(publisher));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, DomainParticipantFactory::get_instance()->delete_participant(participant));
+}
+
 void set_listener_test (
         DataWriter* writer,
         DataWriterListener* listener,
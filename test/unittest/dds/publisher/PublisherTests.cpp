@@ -496,6 +496,50 @@ TEST(PublisherTests, CreateDataWriter)
     ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
 }
 
+TEST(PublisherTests, EnableDataWriters)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    PublisherQos pqos = PUBLISHER_QOS_DEFAULT;
+    pqos.entity_factory().autoenable_created_entities = false;
+    Publisher* publisher = participant->create_publisher(pqos);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    // Nothing to enable
+    ASSERT_EQ(publisher->enable_datawriters(), ReturnCode_t::RETCODE_OK);
+
+    std::vector<DataWriter*> datawriters;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        DataWriter* datawriter = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+        ASSERT_NE(datawriter, nullptr);
+        ASSERT_FALSE(datawriter->is_enabled());
+        datawriters.push_back(datawriter);
+    }
+
+    ASSERT_EQ(publisher->enable_datawriters(), ReturnCode_t::RETCODE_OK);
+    for (DataWriter* datawriter : datawriters)
+    {
+        ASSERT_TRUE(datawriter->is_enabled());
+    }
+
+    // Already enabled DataWriters are skipped
+    ASSERT_EQ(publisher->enable_datawriters(), ReturnCode_t::RETCODE_OK);
+
+    ASSERT_EQ(publisher->delete_contained_entities(), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
 void check_datawriter_with_profile (
         DataWriter* datawriter,
         const std::string& profile_name)
@@ -75,6 +75,7 @@ static constexpr LoanableCollection::size_type num_test_elements = 10;
 
 FASTDDS_SEQUENCE(FooSeq, FooType);
 FASTDDS_SEQUENCE(FooBoundedSeq, FooBoundedType);
+FASTDDS_SEQUENCE(PayloadSeq, SerializedPayload_t);
 using FooArray = LoanableArray<FooType, num_test_elements>;
 using FooStack = StackAllocatedSequence<FooType, num_test_elements>;
 using SampleInfoArray = LoanableArray<SampleInfo, num_test_elements>;
@@ -2342,6 +2343,393 @@ TEST_F(DataReaderTests, Deserialization_errors)
 
 }
 
+/*
+ * This test checks that samples taken into owned collections are correctly returned when their deserialization is
+ * performed after releasing the reader mutex.
+ */
+TEST_F(DataReaderTests, take_deserialize_outside_lock)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 10;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+    const ReturnCode_t& no_data_code = ReturnCode_t::RETCODE_NO_DATA;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.properties().properties().emplace_back("fastdds.deserialize_outside_lock", "true");
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    data.message()[1] = '\0';
+
+    // Repeat to check the collections of deferred changes are correctly reused
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        for (char i = 0; i < num_samples; ++i)
+        {
+            data.message()[0] = i + '0';
+            EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+        }
+
+        EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+        {
+            FooSeq data_seq(num_samples);
+            SampleInfoSeq info_seq(num_samples);
+
+            // Read samples are deserialized while holding the mutex
+            EXPECT_EQ(ok_code, data_reader_->read(data_seq, info_seq, num_samples / 2));
+            check_collection(data_seq, true, num_samples, num_samples / 2);
+            check_sample_values(data_seq, "01234");
+        }
+
+        {
+            FooSeq data_seq(num_samples);
+            SampleInfoSeq info_seq(num_samples);
+
+            // Taken samples are deserialized after releasing the mutex
+            EXPECT_EQ(ok_code, data_reader_->take(data_seq, info_seq, num_samples));
+            check_collection(data_seq, true, num_samples, num_samples);
+            check_sample_values(data_seq, "0123456789");
+            for (SampleInfoSeq::size_type n = 0; n < info_seq.length(); ++n)
+            {
+                EXPECT_TRUE(info_seq[n].valid_data);
+            }
+        }
+
+        {
+            FooSeq data_seq(num_samples);
+            SampleInfoSeq info_seq(num_samples);
+
+            // All samples have been taken
+            EXPECT_EQ(no_data_code, data_reader_->take(data_seq, info_seq, num_samples));
+        }
+    }
+}
+
+/*
+ * This test checks that samples can be read and taken in their serialized form, both on loaned collections, where
+ * the returned payloads reference the reader's payload pool, and on owned collections, where they are copied.
+ */
+TEST_F(DataReaderTests, read_take_serialized)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 4;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+    const ReturnCode_t& no_data_code = ReturnCode_t::RETCODE_NO_DATA;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    data.message()[1] = '\0';
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+    }
+
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    auto check_payloads = [this](const PayloadSeq& payloads, const std::string& values)
+            {
+                ASSERT_EQ(values.size(), static_cast<size_t>(payloads.length()));
+                for (PayloadSeq::size_type n = 0; n < payloads.length(); ++n)
+                {
+                    FooType sample;
+                    SerializedPayload_t& payload = const_cast<SerializedPayload_t&>(payloads[n]);
+                    EXPECT_TRUE(type_.deserialize(&payload, &sample));
+                    EXPECT_EQ(values[n], sample.message()[0]);
+                }
+            };
+
+    {
+        // Loaned payloads are kept until the loan is returned
+        PayloadSeq data_seq;
+        SampleInfoSeq info_seq;
+        EXPECT_EQ(ok_code, data_reader_->read_serialized(data_seq, info_seq));
+        EXPECT_FALSE(data_seq.has_ownership());
+        check_payloads(data_seq, "0123");
+
+        PayloadSeq data_seq2;
+        SampleInfoSeq info_seq2;
+        EXPECT_EQ(ok_code, data_reader_->take_serialized(data_seq2, info_seq2, 2));
+        check_payloads(data_seq2, "01");
+
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq2, info_seq2));
+        check_payloads(data_seq, "0123");
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, info_seq));
+    }
+
+    {
+        // Owned payloads receive a copy of the serialized samples
+        PayloadSeq data_seq(num_samples);
+        SampleInfoSeq info_seq(num_samples);
+        EXPECT_EQ(ok_code, data_reader_->take_serialized(data_seq, info_seq));
+        EXPECT_TRUE(data_seq.has_ownership());
+        check_payloads(data_seq, "23");
+    }
+
+    {
+        PayloadSeq data_seq;
+        SampleInfoSeq info_seq;
+        EXPECT_EQ(no_data_code, data_reader_->take_serialized(data_seq, info_seq));
+    }
+}
+
+/*
+ * This test checks that typed and serialized loans of the same samples are kept apart, and that repeated serialized
+ * loans of a sample share the same payload.
+ */
+TEST_F(DataReaderTests, read_serialized_mixed_with_typed_loans)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 4;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    data.message()[1] = '\0';
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+    }
+
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    PayloadSeq payloads;
+    SampleInfoSeq payload_infos;
+    EXPECT_EQ(ok_code, data_reader_->read_serialized(payloads, payload_infos));
+    ASSERT_EQ(num_samples, payloads.length());
+
+    // Typed loans of samples with an outstanding serialized loan return the deserialized samples
+    FooSeq samples;
+    SampleInfoSeq sample_infos;
+    EXPECT_EQ(ok_code, data_reader_->read(samples, sample_infos));
+    ASSERT_EQ(num_samples, samples.length());
+    for (FooSeq::size_type n = 0; n < samples.length(); ++n)
+    {
+        EXPECT_EQ(static_cast<char>('0' + n), samples[n].message()[0]);
+        EXPECT_NE(static_cast<const void*>(&samples[n]), static_cast<const void*>(&payloads[n]));
+    }
+
+    // Loaning the same samples again as serialized reuses the outstanding loans
+    PayloadSeq payloads2;
+    SampleInfoSeq payload_infos2;
+    EXPECT_EQ(ok_code, data_reader_->read_serialized(payloads2, payload_infos2));
+    ASSERT_EQ(num_samples, payloads2.length());
+    for (PayloadSeq::size_type n = 0; n < payloads2.length(); ++n)
+    {
+        EXPECT_EQ(&payloads[n], &payloads2[n]);
+    }
+
+    FooSeq taken;
+    SampleInfoSeq taken_infos;
+    EXPECT_EQ(ok_code, data_reader_->take(taken, taken_infos));
+    ASSERT_EQ(num_samples, taken.length());
+    for (FooSeq::size_type n = 0; n < taken.length(); ++n)
+    {
+        EXPECT_EQ(static_cast<char>('0' + n), taken[n].message()[0]);
+        EXPECT_EQ(&samples[n], &taken[n]);
+    }
+
+    // Loans can be returned in any order
+    EXPECT_EQ(ok_code, data_reader_->return_loan(samples, sample_infos));
+    EXPECT_EQ(ok_code, data_reader_->return_loan(payloads2, payload_infos2));
+    for (PayloadSeq::size_type n = 0; n < payloads.length(); ++n)
+    {
+        FooType sample;
+        SerializedPayload_t& payload = const_cast<SerializedPayload_t&>(payloads[n]);
+        EXPECT_TRUE(type_.deserialize(&payload, &sample));
+        EXPECT_EQ(static_cast<char>('0' + n), sample.message()[0]);
+    }
+    EXPECT_EQ(ok_code, data_reader_->return_loan(payloads, payload_infos));
+    EXPECT_EQ(ok_code, data_reader_->return_loan(taken, taken_infos));
+}
+
+/*
+ * This test checks that serialized samples loaned by a DataReader can be forwarded by a DataWriter, and that the
+ * forwarded samples are received unchanged once the loan has been returned.
+ */
+TEST_F(DataReaderTests, forward_serialized)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    data.message()[0] = 'A';
+    data.message()[1] = '\0';
+    EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    {
+        PayloadSeq data_seq;
+        SampleInfoSeq info_seq;
+        ASSERT_EQ(ok_code, data_reader_->take_serialized(data_seq, info_seq));
+        ASSERT_EQ(1, data_seq.length());
+
+        // Forward the loaned payload, and write a copy of it
+        EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, data_writer_->forward(nullptr, data_seq[0]));
+        EXPECT_EQ(ok_code, data_writer_->forward(data_reader_, data_seq[0], info_seq[0].instance_handle));
+        EXPECT_EQ(ok_code, data_writer_->write_serialized(data_seq[0]));
+#if !defined(NDEBUG)
+        EXPECT_EQ(ReturnCode_t::RETCODE_PRECONDITION_NOT_MET,
+                data_writer_->write_serialized(data_seq[0], handle_wrong_));
+#endif // if !defined(NDEBUG)
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, info_seq));
+    }
+
+    // Both the forwarded and the copied samples are received
+    FooSeq::size_type received = 0;
+    while (received < 2 && data_reader_->wait_for_unread_message(time_to_wait))
+    {
+        FooSeq data_seq;
+        SampleInfoSeq info_seq;
+        ASSERT_EQ(ok_code, data_reader_->take(data_seq, info_seq));
+        for (FooSeq::size_type n = 0; n < data_seq.length(); ++n)
+        {
+            EXPECT_EQ('A', data_seq[n].message()[0]);
+            EXPECT_EQ(handle_ok_, info_seq[n].instance_handle);
+        }
+        received += data_seq.length();
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, info_seq));
+    }
+    EXPECT_EQ(2, received);
+}
+
+/*
+ * This test checks that samples forwarded to a DataWriter of another topic are kept by the DataWriter after the
+ * DataReader they were loaned from, and every other entity using its payload pool, has been deleted.
+ */
+TEST_F(DataReaderTests, forward_serialized_after_reader_deleted)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.durability().kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    // The forwarding writer uses another topic, hence another payload pool
+    Topic* forward_topic = participant_->create_topic("footopic_forward", type_.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(nullptr, forward_topic);
+    DataWriter* forward_writer = publisher_->create_datawriter(forward_topic, writer_qos);
+    ASSERT_NE(nullptr, forward_writer);
+
+    FooType data;
+    data.index(0);
+    data.message()[1] = '\0';
+    for (char c : {'A', 'B', 'C'})
+    {
+        data.message()[0] = c;
+        EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+    }
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    {
+        PayloadSeq data_seq;
+        SampleInfoSeq info_seq;
+        ASSERT_EQ(ok_code, data_reader_->take_serialized(data_seq, info_seq));
+        ASSERT_EQ(3, data_seq.length());
+        for (PayloadSeq::size_type n = 0; n < data_seq.length(); ++n)
+        {
+            EXPECT_EQ(ok_code, forward_writer->forward(data_reader_, data_seq[n], info_seq[n].instance_handle));
+        }
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_seq, info_seq));
+    }
+
+    // Delete every entity of the original topic, while the forwarding writer still holds the samples
+    ASSERT_EQ(ok_code, publisher_->delete_datawriter(data_writer_));
+    data_writer_ = nullptr;
+    ASSERT_EQ(ok_code, subscriber_->delete_datareader(data_reader_));
+    data_reader_ = nullptr;
+
+    // The forwarded samples are still delivered to late joiners
+    DataReader* forward_reader = subscriber_->create_datareader(forward_topic, reader_qos);
+    ASSERT_NE(nullptr, forward_reader);
+
+    std::string received;
+    while (received.size() < 3 && forward_reader->wait_for_unread_message(time_to_wait))
+    {
+        FooSeq data_seq;
+        SampleInfoSeq info_seq;
+        ASSERT_EQ(ok_code, forward_reader->take(data_seq, info_seq));
+        for (FooSeq::size_type n = 0; n < data_seq.length(); ++n)
+        {
+            received.push_back(data_seq[n].message()[0]);
+        }
+        EXPECT_EQ(ok_code, forward_reader->return_loan(data_seq, info_seq));
+    }
+    EXPECT_EQ("ABC", received);
+
+    ASSERT_EQ(ok_code, subscriber_->delete_datareader(forward_reader));
+    ASSERT_EQ(ok_code, publisher_->delete_datawriter(forward_writer));
+    ASSERT_EQ(ok_code, participant_->delete_topic(forward_topic));
+}
+
 TEST_F(DataReaderTests, TerminateWithoutDestroyingReader)
 {
     destroy_entities_ = false;
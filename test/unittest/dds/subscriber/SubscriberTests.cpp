@@ -565,6 +565,50 @@ TEST(SubscriberTests, CreateDataReader)
     ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
 }
 
+TEST(SubscriberTests, EnableDataReaders)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    SubscriberQos sqos = SUBSCRIBER_QOS_DEFAULT;
+    sqos.entity_factory().autoenable_created_entities = false;
+    Subscriber* subscriber = participant->create_subscriber(sqos);
+    ASSERT_NE(subscriber, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    // Nothing to enable
+    ASSERT_EQ(subscriber->enable_datareaders(), ReturnCode_t::RETCODE_OK);
+
+    std::vector<DataReader*> datareaders;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        DataReader* datareader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+        ASSERT_NE(datareader, nullptr);
+        ASSERT_FALSE(datareader->is_enabled());
+        datareaders.push_back(datareader);
+    }
+
+    ASSERT_EQ(subscriber->enable_datareaders(), ReturnCode_t::RETCODE_OK);
+    for (DataReader* datareader : datareaders)
+    {
+        ASSERT_TRUE(datareader->is_enabled());
+    }
+
+    // Already enabled DataReaders are skipped
+    ASSERT_EQ(subscriber->enable_datareaders(), ReturnCode_t::RETCODE_OK);
+
+    ASSERT_EQ(subscriber->delete_contained_entities(), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_subscriber(subscriber), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
 void check_datareader_with_profile (
         DataReader* datareader,
         const std::string& profile_name)
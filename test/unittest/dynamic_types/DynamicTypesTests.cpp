@@ -25,6 +25,7 @@
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <fastrtps/types/DynamicData.h>
 #include <fastrtps/types/DynamicDataPtr.h>
+#include <fastrtps/types/DynamicDataView.h>
 #include <fastrtps/types/TypeObjectFactory.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
@@ -5068,6 +5069,147 @@ TEST(TypeIdentifierTests, MinimalTypeIdentifierComparision)
     ASSERT_FALSE(unionUnionStruct1 == unionUnion1);
 }
 
+TEST_F(DynamicTypesTests, TypeObjectFactory_builtin_annotations_on_demand)
+{
+    TypeObjectFactory::delete_instance();
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+
+    // Builtin annotations are registered the first time one of them is looked up by name
+    const TypeIdentifier* key_id = factory->get_type_identifier("key", true);
+    ASSERT_NE(key_id, nullptr);
+    ASSERT_EQ(key_id->_d(), EK_COMPLETE);
+    ASSERT_NE(factory->get_type_object(key_id), nullptr);
+    ASSERT_NE(factory->get_type_identifier("optional", false), nullptr);
+    ASSERT_NE(factory->get_type_identifier_trying_complete("extensibility"), nullptr);
+
+    // And also the first time one of them is looked up by its hash
+    TypeIdentifier key_id_copy = *key_id;
+    TypeObjectFactory::delete_instance();
+    factory = TypeObjectFactory::get_instance();
+    const TypeObject* key_object = factory->get_type_object(&key_id_copy);
+    ASSERT_NE(key_object, nullptr);
+    ASSERT_EQ(key_object->_d(), EK_COMPLETE);
+
+    // User types are found by their hash
+    DynamicTypeBuilder_ptr builder = DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+    builder->add_member(0, "int", DynamicTypeBuilderFactory::get_instance()->create_int32_type());
+    builder->set_name("HashedStruct");
+    DynamicType_ptr type = builder->build();
+    TypeObject type_object;
+    DynamicTypeBuilderFactory::get_instance()->build_type_object(type, type_object, false);
+    const TypeIdentifier* struct_id = factory->get_type_identifier("HashedStruct", false);
+    ASSERT_NE(struct_id, nullptr);
+    TypeIdentifier struct_id_copy = *struct_id;
+    ASSERT_EQ(factory->get_type_object(&struct_id_copy), factory->get_type_object(struct_id));
+}
+
+TEST_F(DynamicTypesTests, DynamicDataView_unit_tests)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+    DynamicTypeBuilder_ptr inner_builder = factory->create_struct_builder();
+    ASSERT_TRUE(inner_builder->add_member(0, "flag", factory->create_bool_type()) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(inner_builder->add_member(1, "value", factory->create_float64_type()) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(inner_builder->add_member(2, "label", factory->create_string_type()) == ReturnCode_t::RETCODE_OK);
+    DynamicType_ptr inner_type = inner_builder->build();
+
+    DynamicTypeBuilder_ptr int16_builder = factory->create_int16_builder();
+    DynamicTypeBuilder_ptr seq_builder = factory->create_sequence_builder(int16_builder.get());
+    DynamicTypeBuilder_ptr outer_builder = factory->create_struct_builder();
+    ASSERT_TRUE(outer_builder->add_member(0, "id", factory->create_int32_type()) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(outer_builder->add_member(1, "stamp", factory->create_uint64_type()) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(outer_builder->add_member(2, "name", factory->create_string_type()) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(outer_builder->add_member(3, "samples", seq_builder->build()) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(outer_builder->add_member(4, "inner", inner_type) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(outer_builder->add_member(5, "tail", factory->create_char8_type()) == ReturnCode_t::RETCODE_OK);
+    DynamicType_ptr outer_type = outer_builder->build();
+    ASSERT_TRUE(outer_type != nullptr);
+
+    DynamicData_ptr data(DynamicDataFactory::get_instance()->create_data(outer_type));
+    ASSERT_TRUE(data->set_int32_value(-42, 0) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(data->set_uint64_value(0x0102030405060708ull, 1) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(data->set_string_value("dynamic", 2) == ReturnCode_t::RETCODE_OK);
+    DynamicData* samples = data->loan_value(3);
+    ASSERT_TRUE(samples != nullptr);
+    for (int16_t i = 0; i < 5; ++i)
+    {
+        MemberId new_id;
+        ASSERT_TRUE(samples->insert_sequence_data(new_id) == ReturnCode_t::RETCODE_OK);
+        ASSERT_TRUE(samples->set_int16_value(i * 3, new_id) == ReturnCode_t::RETCODE_OK);
+    }
+    ASSERT_TRUE(data->return_loaned_value(samples) == ReturnCode_t::RETCODE_OK);
+    DynamicData* inner = data->loan_value(4);
+    ASSERT_TRUE(inner != nullptr);
+    ASSERT_TRUE(inner->set_bool_value(true, 0) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(inner->set_float64_value(3.5, 1) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(inner->set_string_value("nested", 2) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(data->return_loaned_value(inner) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(data->set_char8_value('z', 5) == ReturnCode_t::RETCODE_OK);
+
+    DynamicPubSubType pubsubType(outer_type);
+    uint32_t payloadSize = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(data.get())());
+    SerializedPayload_t payload(payloadSize);
+    ASSERT_TRUE(pubsubType.serialize(data.get(), &payload));
+
+    DynamicDataView unbound;
+    ASSERT_EQ(unbound.bind(payload), ReturnCode_t::RETCODE_PRECONDITION_NOT_MET);
+
+    DynamicDataView view(outer_type);
+    ASSERT_EQ(view.bind(payload), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(view.get_kind(), TK_STRUCTURE);
+    ASSERT_EQ(view.get_item_count(), 6u);
+    ASSERT_EQ(view.get_member_id_by_name("inner"), 4u);
+    ASSERT_EQ(view.get_member_id_by_name("unknown"), MEMBER_ID_INVALID);
+
+    int32_t id = 0;
+    ASSERT_EQ(view.get_int32_value(id, 0), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(id, -42);
+    uint64_t stamp = 0;
+    ASSERT_EQ(view.get_uint64_value(stamp, 1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(stamp, 0x0102030405060708ull);
+    std::string name;
+    ASSERT_EQ(view.get_string_value(name, 2), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(name, "dynamic");
+    char tail = 0;
+    ASSERT_EQ(view.get_char8_value(tail, 5), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(tail, 'z');
+
+    // Wrong kind and unknown members
+    ASSERT_EQ(view.get_int64_value(stamp, 0), ReturnCode_t::RETCODE_BAD_PARAMETER);
+    ASSERT_EQ(view.get_int32_value(id, 10), ReturnCode_t::RETCODE_BAD_PARAMETER);
+
+    DynamicDataView samples_view;
+    ASSERT_EQ(view.get_complex_value(samples_view, 3), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(samples_view.get_kind(), TK_SEQUENCE);
+    ASSERT_EQ(samples_view.get_item_count(), 5u);
+    for (MemberId i = 0; i < 5; ++i)
+    {
+        int16_t sample = 0;
+        ASSERT_EQ(samples_view.get_int16_value(sample, i), ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(sample, static_cast<int16_t>(i * 3));
+    }
+    int16_t sample = 0;
+    ASSERT_EQ(samples_view.get_int16_value(sample, 5), ReturnCode_t::RETCODE_BAD_PARAMETER);
+
+    DynamicDataView inner_view;
+    ASSERT_EQ(view.get_complex_value(inner_view, 4), ReturnCode_t::RETCODE_OK);
+    bool flag = false;
+    ASSERT_EQ(inner_view.get_bool_value(flag, 0), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(flag);
+    double value = 0;
+    ASSERT_EQ(inner_view.get_float64_value(value, 1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(value, 3.5);
+    std::string label;
+    ASSERT_EQ(inner_view.get_string_value(label, 2), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(label, "nested");
+
+    // Truncated payloads are detected
+    payload.length = 12;
+    ASSERT_EQ(view.bind(payload), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(view.get_int32_value(id, 0), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(view.get_char8_value(tail, 5), ReturnCode_t::RETCODE_ERROR);
+}
+
 int main(
         int argc,
         char** argv)
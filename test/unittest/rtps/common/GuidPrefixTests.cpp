@@ -12,6 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <gtest/gtest.h>
 
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
@@ -181,6 +185,67 @@ TEST(GuidPrefixTests, equality)
     }
 }
 
+/**
+ * @brief This test checks the \c std::hash specialization of Guid Prefix.
+ *
+ * Equal prefixes should give equal hashes, and the prefixes on the manually sorted vector, which differ on a single
+ * byte, should give different ones.
+ */
+TEST(GuidPrefixTests, hash)
+{
+    auto manually_sorted_prefixes = test::get_sorted_guidprefix_vector();
+    std::hash<GuidPrefix> hasher;
+
+    std::unordered_set<std::size_t> hashes;
+    for (const GuidPrefix& prefix : manually_sorted_prefixes)
+    {
+        GuidPrefix copy = prefix;
+        ASSERT_EQ(hasher(prefix), hasher(copy)) << prefix;
+        ASSERT_TRUE(hashes.insert(hasher(prefix)).second) << prefix;
+    }
+
+    // Prefixes of the participants of a host only differ on the bytes identifying the process and the participant
+    GuidPrefix prefix;
+    prefix.value[0] = 0x01;
+    prefix.value[1] = 0x0f;
+    hashes.clear();
+    for (uint32_t i = 0; i < 0x1000; ++i)
+    {
+        prefix.value[6] = static_cast<eprosima::fastrtps::rtps::octet>(i & 0xFF);
+        prefix.value[11] = static_cast<eprosima::fastrtps::rtps::octet>(i >> 8);
+        ASSERT_TRUE(hashes.insert(hasher(prefix)).second) << prefix;
+    }
+}
+
+/**
+ * @brief This test checks Guid Prefixes can be used as keys of the standard hashed containers.
+ */
+TEST(GuidPrefixTests, hashed_containers)
+{
+    auto manually_sorted_prefixes = test::get_sorted_guidprefix_vector();
+
+    std::unordered_map<GuidPrefix, std::size_t> prefix_map;
+    for (std::size_t i = 0; i < manually_sorted_prefixes.size(); ++i)
+    {
+        ASSERT_TRUE(prefix_map.emplace(manually_sorted_prefixes[i], i).second);
+    }
+    // Duplicated keys are not inserted
+    ASSERT_FALSE(prefix_map.emplace(manually_sorted_prefixes[0], 0).second);
+    ASSERT_EQ(manually_sorted_prefixes.size(), prefix_map.size());
+
+    for (std::size_t i = 0; i < manually_sorted_prefixes.size(); ++i)
+    {
+        auto it = prefix_map.find(manually_sorted_prefixes[i]);
+        ASSERT_NE(prefix_map.end(), it);
+        ASSERT_EQ(i, it->second);
+    }
+
+    ASSERT_EQ(1u, prefix_map.erase(manually_sorted_prefixes[1]));
+    ASSERT_EQ(prefix_map.end(), prefix_map.find(manually_sorted_prefixes[1]));
+    ASSERT_EQ(0u, prefix_map.erase(manually_sorted_prefixes[1]));
+    ASSERT_EQ(manually_sorted_prefixes.size() - 1, prefix_map.size());
+}
+
 int main(
         int argc,
         char** argv)
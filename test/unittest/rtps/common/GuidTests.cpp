@@ -12,6 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <gtest/gtest.h>
 
 #include <fastdds/rtps/common/Guid.h>
@@ -173,6 +177,66 @@ TEST(GuidTests, equality)
     }
 }
 
+/**
+ * @brief This test checks the \c std::hash specialization of Guid.
+ *
+ * Equal guids should give equal hashes, and the guids on the manually sorted vector, which differ on a single
+ * byte of the prefix or the entity id, should give different ones.
+ */
+TEST(GuidTests, hash)
+{
+    auto manually_sorted_guids = test::get_sorted_guid_vector();
+    std::hash<Guid> hasher;
+
+    std::unordered_set<std::size_t> hashes;
+    for (const Guid& guid : manually_sorted_guids)
+    {
+        Guid copy = guid;
+        ASSERT_EQ(hasher(guid), hasher(copy)) << guid;
+        ASSERT_TRUE(hashes.insert(hasher(guid)).second) << guid;
+    }
+
+    // Guids of the endpoints of a participant only differ on the entity id
+    Guid guid;
+    guid.guidPrefix.value[0] = 0x01;
+    hashes.clear();
+    for (uint32_t i = 0; i < 0x1000; ++i)
+    {
+        guid.entityId = i;
+        ASSERT_TRUE(hashes.insert(hasher(guid)).second) << guid;
+    }
+}
+
+/**
+ * @brief This test checks guids can be used as keys of the standard hashed containers.
+ */
+TEST(GuidTests, hashed_containers)
+{
+    auto manually_sorted_guids = test::get_sorted_guid_vector();
+
+    std::unordered_multimap<Guid, std::size_t> guid_multimap;
+    for (std::size_t i = 0; i < manually_sorted_guids.size(); ++i)
+    {
+        guid_multimap.emplace(manually_sorted_guids[i], i);
+        guid_multimap.emplace(manually_sorted_guids[i], i + manually_sorted_guids.size());
+    }
+    ASSERT_EQ(2 * manually_sorted_guids.size(), guid_multimap.size());
+
+    for (std::size_t i = 0; i < manually_sorted_guids.size(); ++i)
+    {
+        auto range = guid_multimap.equal_range(manually_sorted_guids[i]);
+        ASSERT_EQ(2, std::distance(range.first, range.second));
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            ASSERT_EQ(i, it->second % manually_sorted_guids.size());
+        }
+    }
+
+    Guid unknown_guid;
+    unknown_guid.guidPrefix.value[1] = 0x01;
+    ASSERT_EQ(guid_multimap.end(), guid_multimap.find(unknown_guid));
+}
+
 int main(
         int argc,
         char** argv)
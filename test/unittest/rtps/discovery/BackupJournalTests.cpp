@@ -0,0 +1,321 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/database/backup/BackupJournal.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::rtps::ddb::BackupJournal;
+
+class BackupJournalTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        std::remove(file_name.c_str());
+    }
+
+    void TearDown() override
+    {
+        std::remove(file_name.c_str());
+    }
+
+    static void fill_change(
+            CacheChange_t& change,
+            uint32_t id)
+    {
+        change.kind = (id % 2) ? ALIVE : NOT_ALIVE_DISPOSED_UNREGISTERED;
+        change.writerGUID.guidPrefix.value[0] = 0x01;
+        change.writerGUID.guidPrefix.value[11] = static_cast<octet>(id);
+        change.writerGUID.entityId = c_EntityId_SPDPWriter;
+        GUID_t entity(change.writerGUID.guidPrefix, c_EntityId_RTPSParticipant);
+        change.instanceHandle = entity;
+        change.sequenceNumber = SequenceNumber_t(static_cast<int32_t>(id), 0x01020304u + id);
+        change.isRead = (0 == id % 3);
+        change.sourceTimestamp = Time_t(static_cast<int32_t>(id), 0x10203040u);
+        change.reader_info.receptionTimestamp = Time_t(-static_cast<int32_t>(id), 5u);
+        change.write_params.sample_identity().writer_guid(change.writerGUID);
+        change.write_params.sample_identity().sequence_number(change.sequenceNumber);
+        change.write_params.related_sample_identity().sequence_number(SequenceNumber_t(0, id));
+        change.serializedPayload.encapsulation = PL_CDR_LE;
+        change.serializedPayload.length = id;
+        for (uint32_t i = 0; i < id; ++i)
+        {
+            change.serializedPayload.data[i] = static_cast<octet>(i * 7 + id);
+        }
+    }
+
+    static void check_record(
+            const BackupJournal::Record& record,
+            const CacheChange_t& change)
+    {
+        EXPECT_EQ(change.kind, record.kind);
+        EXPECT_EQ(change.writerGUID, record.writer_guid);
+        EXPECT_EQ(change.instanceHandle, record.instance_handle);
+        EXPECT_EQ(change.sequenceNumber, record.sequence_number);
+        EXPECT_EQ(change.isRead, record.is_read);
+        EXPECT_EQ(change.sourceTimestamp, record.source_timestamp);
+        EXPECT_EQ(change.reader_info.receptionTimestamp, record.reception_timestamp);
+        EXPECT_EQ(change.write_params.sample_identity(), record.sample_identity);
+        EXPECT_EQ(change.write_params.related_sample_identity(), record.related_sample_identity);
+        EXPECT_EQ(change.serializedPayload.encapsulation, record.encapsulation);
+        ASSERT_EQ(change.serializedPayload.length, record.payload.size());
+        EXPECT_EQ(0, std::memcmp(change.serializedPayload.data, record.payload.data(), record.payload.size()));
+    }
+
+    const std::string file_name = "BackupJournalTests_queue.bin";
+};
+
+TEST_F(BackupJournalTests, round_trip)
+{
+    std::vector<CacheChange_t*> changes;
+    for (uint32_t id = 1; id <= 10; ++id)
+    {
+        changes.push_back(new CacheChange_t(id));
+        fill_change(*changes.back(), id);
+    }
+
+    BackupJournal journal;
+    ASSERT_TRUE(journal.open(file_name));
+    for (CacheChange_t* change : changes)
+    {
+        journal.append(*change);
+    }
+    // After sync the records are on the file, even while the journal is still open
+    journal.sync();
+
+    std::vector<BackupJournal::Record> records;
+    ASSERT_TRUE(BackupJournal::read(file_name, records));
+    ASSERT_EQ(changes.size(), records.size());
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        check_record(records[i], *changes[i]);
+
+        CacheChange_t restored(changes[i]->serializedPayload.length);
+        ASSERT_TRUE(records[i].to_change(restored));
+        EXPECT_EQ(changes[i]->sequenceNumber, restored.sequenceNumber);
+        EXPECT_EQ(changes[i]->serializedPayload, restored.serializedPayload);
+    }
+
+    // A change without room for the payload cannot be filled
+    CacheChange_t too_small(1);
+    EXPECT_FALSE(records.back().to_change(too_small));
+
+    journal.close();
+    for (CacheChange_t* change : changes)
+    {
+        delete change;
+    }
+}
+
+TEST_F(BackupJournalTests, little_endian_encoding)
+{
+    CacheChange_t change(4);
+    fill_change(change, 4);
+
+    std::vector<uint8_t> buffer;
+    BackupJournal::encode(change, buffer);
+
+    // Length prefix
+    size_t record_size = buffer.size() - 4;
+    EXPECT_EQ(record_size & 0xFF, buffer[0]);
+    EXPECT_EQ((record_size >> 8) & 0xFF, buffer[1]);
+    EXPECT_EQ(0u, buffer[2]);
+    EXPECT_EQ(0u, buffer[3]);
+
+    // Sequence number follows the kind, the writer GUID and the instance handle
+    size_t sn_offset = 4 + 1 + 16 + 16;
+    const uint8_t expected_sn[] = {4, 0, 0, 0, 0x08, 0x03, 0x02, 0x01};
+    EXPECT_EQ(0, std::memcmp(expected_sn, &buffer[sn_offset], sizeof(expected_sn)));
+
+    // Payload length precedes the payload at the end of the record
+    size_t length_offset = buffer.size() - 4 - 4;
+    const uint8_t expected_length[] = {4, 0, 0, 0};
+    EXPECT_EQ(0, std::memcmp(expected_length, &buffer[length_offset], sizeof(expected_length)));
+}
+
+TEST_F(BackupJournalTests, truncate)
+{
+    CacheChange_t first(8);
+    fill_change(first, 8);
+    CacheChange_t second(5);
+    fill_change(second, 5);
+
+    BackupJournal journal;
+    ASSERT_TRUE(journal.open(file_name));
+    journal.append(first);
+    journal.sync();
+    journal.truncate();
+    // Nothing left to wait for after a truncation
+    journal.sync();
+    journal.append(second);
+    journal.close();
+
+    std::vector<BackupJournal::Record> records;
+    ASSERT_TRUE(BackupJournal::read(file_name, records));
+    ASSERT_EQ(1u, records.size());
+    check_record(records[0], second);
+
+    // Reopening keeps the records not yet dumped
+    ASSERT_TRUE(journal.open(file_name));
+    journal.append(first);
+    journal.close();
+
+    records.clear();
+    ASSERT_TRUE(BackupJournal::read(file_name, records));
+    ASSERT_EQ(2u, records.size());
+    check_record(records[0], second);
+    check_record(records[1], first);
+}
+
+TEST_F(BackupJournalTests, torn_tail)
+{
+    CacheChange_t first(6);
+    fill_change(first, 6);
+    CacheChange_t second(9);
+    fill_change(second, 9);
+
+    std::vector<uint8_t> buffer;
+    BackupJournal::encode(first, buffer);
+    size_t first_size = buffer.size();
+    BackupJournal::encode(second, buffer);
+
+    // Cut the second record at every possible point
+    for (size_t size = first_size; size < buffer.size(); ++size)
+    {
+        std::vector<BackupJournal::Record> records;
+        ASSERT_TRUE(BackupJournal::decode(buffer.data(), size, records));
+        ASSERT_EQ(1u, records.size());
+        check_record(records[0], first);
+    }
+
+    std::vector<BackupJournal::Record> records;
+    ASSERT_TRUE(BackupJournal::decode(buffer.data(), buffer.size(), records));
+    ASSERT_EQ(2u, records.size());
+    check_record(records[1], second);
+}
+
+TEST_F(BackupJournalTests, malformed_record)
+{
+    CacheChange_t change(6);
+    fill_change(change, 6);
+
+    std::vector<uint8_t> buffer;
+    BackupJournal::encode(change, buffer);
+
+    // Payload length not matching the record length
+    std::vector<uint8_t> bad_length = buffer;
+    bad_length[bad_length.size() - 6 - 4] = 7;
+    std::vector<BackupJournal::Record> records;
+    EXPECT_FALSE(BackupJournal::decode(bad_length.data(), bad_length.size(), records));
+
+    // Unknown change kind
+    std::vector<uint8_t> bad_kind = buffer;
+    bad_kind[4] = 0xFF;
+    EXPECT_FALSE(BackupJournal::decode(bad_kind.data(), bad_kind.size(), records));
+}
+
+TEST_F(BackupJournalTests, bounded_pending_records)
+{
+    constexpr uint32_t num_changes = 200;
+    CacheChange_t change(64);
+    fill_change(change, 64);
+
+    // Only a record can be waiting for the writing thread, so appending never blocks and some records are dropped
+    BackupJournal journal(1);
+    ASSERT_TRUE(journal.open(file_name));
+    std::vector<SequenceNumber_t> journaled;
+    for (uint32_t i = 0; i < num_changes; ++i)
+    {
+        change.sequenceNumber = SequenceNumber_t(0, i + 1);
+        if (journal.append(change))
+        {
+            journaled.push_back(change.sequenceNumber);
+        }
+    }
+    journal.sync();
+    ASSERT_FALSE(journaled.empty());
+
+    std::vector<BackupJournal::Record> records;
+    ASSERT_TRUE(BackupJournal::read(file_name, records));
+    ASSERT_EQ(journaled.size(), records.size());
+    for (size_t i = 0; i < journaled.size(); ++i)
+    {
+        EXPECT_EQ(journaled[i], records[i].sequence_number);
+    }
+    journal.close();
+
+    // Nothing is journaled once closed
+    EXPECT_FALSE(journal.append(change));
+}
+
+/*
+ * Records of entities that were never on a database dump, as after a restart with only the journal left.
+ * Each one should be classified on its builtin topic from the kind of the entity it announces.
+ */
+TEST_F(BackupJournalTests, journal_only_entities)
+{
+    struct Entity
+    {
+        EntityId_t entity_id;
+        BackupJournal::Record::Topic topic;
+    };
+
+    const std::vector<Entity> entities = {
+        {c_EntityId_RTPSParticipant, BackupJournal::Record::Topic::PARTICIPANTS},
+        {EntityId_t(0x102), BackupJournal::Record::Topic::PUBLICATIONS},
+        {EntityId_t(0x203), BackupJournal::Record::Topic::PUBLICATIONS},
+        {c_EntityId_SEDPPubWriter, BackupJournal::Record::Topic::PUBLICATIONS},
+        {EntityId_t(0x304), BackupJournal::Record::Topic::SUBSCRIPTIONS},
+        {EntityId_t(0x407), BackupJournal::Record::Topic::SUBSCRIPTIONS},
+        {c_EntityId_SEDPPubReader, BackupJournal::Record::Topic::SUBSCRIPTIONS},
+        {c_EntityId_Unknown, BackupJournal::Record::Topic::UNKNOWN},
+    };
+
+    BackupJournal journal;
+    ASSERT_TRUE(journal.open(file_name));
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        CacheChange_t change(8);
+        fill_change(change, 8);
+        GUID_t entity(change.writerGUID.guidPrefix, entities[i].entity_id);
+        change.instanceHandle = entity;
+        change.sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(i + 1));
+        ASSERT_TRUE(journal.append(change));
+    }
+    journal.close();
+
+    std::vector<BackupJournal::Record> records;
+    ASSERT_TRUE(BackupJournal::read(file_name, records));
+    ASSERT_EQ(entities.size(), records.size());
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        EXPECT_EQ(entities[i].topic, records[i].topic()) << "Entity " << entities[i].entity_id;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,140 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/writer/ReaderProxy.h>
+#include <fastdds/rtps/writer/StatefulWriter.h>
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+
+#include <set>
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::rtps::ddb::DiscoveryDataBase;
+using eprosima::fastdds::rtps::ddb::DiscoveryParticipantChangeData;
+using eprosima::fastdds::rtps::ddb::PDPDataFilter;
+
+class DiscoveryDataBaseTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        server_prefix.value[0] = 1;
+        writer_participant.value[0] = 2;
+        reader_participant.value[0] = 3;
+    }
+
+    void TearDown() override
+    {
+        db.disable();
+        db.clear();
+    }
+
+    static void fill_change(
+            CacheChange_t& change,
+            const GuidPrefix_t& prefix,
+            const EntityId_t& writer_id,
+            const EntityId_t& entity_id,
+            const SequenceNumber_t& sequence_number)
+    {
+        change.kind = ALIVE;
+        change.writerGUID = GUID_t(prefix, writer_id);
+        change.instanceHandle = GUID_t(prefix, entity_id);
+        change.sequenceNumber = sequence_number;
+        change.write_params.sample_identity().writer_guid(change.writerGUID);
+        change.write_params.sample_identity().sequence_number(sequence_number);
+    }
+
+    GuidPrefix_t server_prefix;
+    GuidPrefix_t writer_participant;
+    GuidPrefix_t reader_participant;
+    DiscoveryDataBase db{server_prefix, std::set<GuidPrefix_t>()};
+};
+
+/*!
+ * The PDP acknowledgements recorded by the AckedFunctor decide whether the EDP changes of a participant are relevant
+ * to another one. PDPServer checks the EDP histories again whenever participant_acks_generation() moves, so it must
+ * move each time a participant acknowledges a DATA(p) for the first time, and only then.
+ */
+TEST_F(DiscoveryDataBaseTests, participant_ack_makes_edp_relevant)
+{
+    CacheChange_t writer_participant_data;
+    fill_change(writer_participant_data, writer_participant, c_EntityId_SPDPWriter, c_EntityId_RTPSParticipant,
+            SequenceNumber_t(0, 1));
+    CacheChange_t reader_participant_data;
+    fill_change(reader_participant_data, reader_participant, c_EntityId_SPDPWriter, c_EntityId_RTPSParticipant,
+            SequenceNumber_t(0, 1));
+    CacheChange_t writer_data;
+    fill_change(writer_data, writer_participant, c_EntityId_SEDPPubWriter, EntityId_t(0x00000103),
+            SequenceNumber_t(0, 1));
+    CacheChange_t reader_data;
+    fill_change(reader_data, reader_participant, c_EntityId_SEDPSubWriter, EntityId_t(0x00000104),
+            SequenceNumber_t(0, 1));
+
+    DiscoveryParticipantChangeData client_data(RemoteLocatorList(0, 0), true, true);
+    ASSERT_TRUE(db.update(&writer_participant_data, client_data));
+    ASSERT_TRUE(db.update(&reader_participant_data, client_data));
+    db.process_pdp_data_queue();
+    ASSERT_TRUE(db.update(&writer_data, "topic"));
+    ASSERT_TRUE(db.update(&reader_data, "topic"));
+    db.process_edp_data_queue();
+    db.process_dirty_topics();
+
+    // The DATA(w) cannot be sent to the reader's participant until it has acknowledged the DATA(p)
+    GUID_t edp_reader(reader_participant, c_EntityId_SEDPPubReader);
+    ASSERT_FALSE(db.edp_publications_is_relevant(writer_data, edp_reader));
+
+    // Acknowledge the DATA(p) of the writer's participant from the PDP reader of the reader's participant
+    StatefulWriter pdp_writer;
+    pdp_writer.reader_data_filter(static_cast<PDPDataFilter<DiscoveryDataBase>*>(&db));
+    WriterTimes times;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy pdp_reader_proxy(times, alloc, &pdp_writer);
+    ReaderProxyData pdp_reader(0, 0);
+    pdp_reader.guid(GUID_t(reader_participant, c_EntityId_SPDPReader));
+    pdp_reader.m_qos.m_reliability.kind = eprosima::fastrtps::RELIABLE_RELIABILITY_QOS;
+    pdp_reader.m_qos.m_durability.kind = eprosima::fastrtps::TRANSIENT_LOCAL_DURABILITY_QOS;
+    pdp_reader_proxy.start(pdp_reader);
+    pdp_reader_proxy.add_change(ChangeForReader_t(&writer_participant_data), true, false);
+    pdp_reader_proxy.acked_changes_set(SequenceNumber_t(0, 2));
+
+    uint64_t generation = db.participant_acks_generation();
+    {
+        DiscoveryDataBase::AckedFunctor functor = db.functor(&writer_participant_data);
+        functor(&pdp_reader_proxy);
+        EXPECT_FALSE(functor);
+    }
+    EXPECT_EQ(generation + 1, db.participant_acks_generation());
+    EXPECT_TRUE(db.edp_publications_is_relevant(writer_data, edp_reader));
+
+    // A repeated acknowledgement does not change the relevance of any EDP change
+    {
+        DiscoveryDataBase::AckedFunctor functor = db.functor(&writer_participant_data);
+        functor(&pdp_reader_proxy);
+    }
+    EXPECT_EQ(generation + 1, db.participant_acks_generation());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
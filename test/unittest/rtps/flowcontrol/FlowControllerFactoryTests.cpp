@@ -11,7 +11,7 @@ TEST(FlowControllerFactory, get_default_flow_controllers)
     FlowController* flow_controller = nullptr;
 
     // Initialize factory.
-    factory.init(nullptr);
+    factory.init(nullptr, ThreadSettings());
 
     eprosima::fastrtps::rtps::WriterAttributes besteffort_sync_attributes;
     besteffort_sync_attributes.endpoint.reliabilityKind = eprosima::fastrtps::rtps::BEST_EFFORT;
@@ -58,7 +58,7 @@ TEST(FlowControllerFactory, register_flow_controllers)
     eprosima::fastrtps::rtps::WriterAttributes writer_attributes;
 
     // Initialize factory.
-    factory.init(nullptr);
+    factory.init(nullptr, ThreadSettings());
 
     // AsyncFlowController with Fifo scheduler
     const char* async_fifo = "AsyncFlowControllerFifo";
@@ -16,6 +16,7 @@
 
 #include <rtps/history/TopicPayloadPool.hpp>
 
+#include <cstring>
 #include <tuple>
 
 using namespace eprosima::fastrtps::rtps;
@@ -406,6 +407,33 @@ TEST_P(TopicPayloadPoolTests, release_history_writer_finite_size)
     do_history_test(reserve_size, reserve_max_size, false);
 }
 
+TEST_P(TopicPayloadPoolTests, release_history_with_payloads_in_use)
+{
+    // A history is released while some payloads are still referenced by another entity, as when a writer forwards
+    // the payloads of a reader.
+    PoolConfig config{ memory_policy, payload_size, 2u, 2u };
+    ASSERT_TRUE(pool->reserve_history(config, true));
+
+    CacheChange_t changes[2];
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(pool->get_payload(payload_size, change));
+    }
+
+    pool->release_history(config, true);
+
+    // The payloads in use are kept, and released once they are returned
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_NE(nullptr, change.serializedPayload.data);
+        memset(change.serializedPayload.data, 0xAA, change.serializedPayload.max_size);
+        EXPECT_TRUE(pool->release_payload(change));
+    }
+
+    EXPECT_EQ(0u, pool->payload_pool_allocated_size());
+    EXPECT_EQ(0u, pool->payload_pool_available_size());
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -0,0 +1,175 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <fastrtps/rtps/history/WriterHistory.h>
+#include <fastrtps/rtps/writer/RTPSWriter.h>
+#include <fastrtps/utils/TimedMutex.hpp>
+
+using namespace eprosima::fastrtps;
+using namespace ::rtps;
+using namespace ::testing;
+using namespace std;
+
+class TestWriterHistory : public WriterHistory
+{
+public:
+
+    TestWriterHistory(
+            const HistoryAttributes& att,
+            RTPSWriter* writer,
+            RecursiveTimedMutex* mutex)
+        : WriterHistory(att)
+    {
+        mp_writer = writer;
+        mp_mutex = mutex;
+    }
+
+};
+
+class WriterHistoryTests : public Test
+{
+protected:
+
+    HistoryAttributes history_attr;
+    TestWriterHistory* history;
+    NiceMock<RTPSWriter>* writerMock;
+    RecursiveTimedMutex mutex;
+
+    uint32_t num_changes = 10;
+    vector<CacheChange_t*> changes_list;
+
+    virtual void SetUp()
+    {
+        history_attr.memoryPolicy = MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE;
+        history_attr.payloadMaxSize = 4;
+        history_attr.initialReservedCaches = 10;
+        history_attr.maximumReservedCaches = 20;
+
+        writerMock = new NiceMock<RTPSWriter>();
+        ON_CALL(*writerMock, getMaxDataSize()).WillByDefault(Return(65000u));
+        history = new TestWriterHistory(history_attr, writerMock, &mutex);
+
+        // Changes get consecutive sequence numbers starting on 1
+        for (uint32_t i = 0; i < num_changes; i++)
+        {
+            CacheChange_t* ch = new CacheChange_t(0);
+            ch->writerGUID = writerMock->getGuid();
+            changes_list.push_back(ch);
+            ASSERT_TRUE(history->add_change(ch));
+        }
+    }
+
+    virtual void TearDown()
+    {
+        for (CacheChange_t* ch : changes_list)
+        {
+            delete ch;
+        }
+
+        delete history;
+        delete writerMock;
+    }
+
+    //! Look for a change by its sequence number
+    History::const_iterator find(
+            const SequenceNumber_t& sequence_number)
+    {
+        CacheChange_t ch;
+        ch.writerGUID = writerMock->getGuid();
+        ch.sequenceNumber = sequence_number;
+        return history->find_change_nts(&ch);
+    }
+
+};
+
+TEST_F(WriterHistoryTests, find_change_consecutive)
+{
+    // Sequence numbers are consecutive, so every change is found on its offset from the first one
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        History::const_iterator it = history->find_change_nts(changes_list[i]);
+        ASSERT_NE(history->changesEnd(), it);
+        EXPECT_EQ(changes_list[i], *it);
+        EXPECT_EQ(static_cast<ptrdiff_t>(i), it - history->changesBegin());
+    }
+
+    // Sequence numbers out of the range of the history
+    EXPECT_EQ(history->changesEnd(), find(SequenceNumber_t(0, 0)));
+    EXPECT_EQ(history->changesEnd(), find(SequenceNumber_t(0, num_changes + 1)));
+
+    // Oldest changes are removed from the front, keeping the remaining ones consecutive
+    EXPECT_CALL(*writerMock, release_change(_)).Times(2);
+    ASSERT_TRUE(history->remove_min_change());
+    ASSERT_TRUE(history->remove_min_change());
+    EXPECT_EQ(history->changesEnd(), find(SequenceNumber_t(0, 1)));
+    EXPECT_EQ(history->changesEnd(), find(SequenceNumber_t(0, 2)));
+    for (uint32_t i = 2; i < num_changes; i++)
+    {
+        History::const_iterator it = history->find_change_nts(changes_list[i]);
+        ASSERT_NE(history->changesEnd(), it);
+        EXPECT_EQ(changes_list[i], *it);
+        EXPECT_EQ(static_cast<ptrdiff_t>(i - 2), it - history->changesBegin());
+    }
+}
+
+TEST_F(WriterHistoryTests, find_change_with_gaps)
+{
+    // Removing changes in the middle leaves gaps on the sequence numbers, so changes after them are not on their
+    // offset from the first one and should be found with a binary search
+    EXPECT_CALL(*writerMock, release_change(_)).Times(2);
+    ASSERT_TRUE(history->remove_change(SequenceNumber_t(0, 4)));
+    ASSERT_TRUE(history->remove_change(SequenceNumber_t(0, 7)));
+
+    ptrdiff_t expected_position = 0;
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        SequenceNumber_t sequence_number(0, i + 1);
+        History::const_iterator it = find(sequence_number);
+        if (4 == i + 1 || 7 == i + 1)
+        {
+            EXPECT_EQ(history->changesEnd(), it);
+            continue;
+        }
+
+        ASSERT_NE(history->changesEnd(), it);
+        EXPECT_EQ(changes_list[i], *it);
+        EXPECT_EQ(expected_position, it - history->changesBegin());
+        ++expected_position;
+    }
+
+    EXPECT_EQ(history->changesEnd(), find(SequenceNumber_t(0, 0)));
+    EXPECT_EQ(history->changesEnd(), find(SequenceNumber_t(0, num_changes + 1)));
+}
+
+TEST_F(WriterHistoryTests, find_change_other_writer)
+{
+    CacheChange_t ch;
+    ch.writerGUID = GUID_t(GuidPrefix_t::unknown(), 0xFFu);
+    ch.sequenceNumber = SequenceNumber_t(0, 1);
+    EXPECT_EQ(history->changesEnd(), history->find_change_nts(&ch));
+    EXPECT_EQ(history->changesEnd(), history->find_change_nts(nullptr));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
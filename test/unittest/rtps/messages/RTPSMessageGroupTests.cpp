@@ -0,0 +1,283 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <fastdds/rtps/Endpoint.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace ::testing;
+
+namespace {
+
+constexpr octet SUBMSG_INFO_DST = 0x0e;
+constexpr octet SUBMSG_INFO_TS = 0x09;
+constexpr octet SUBMSG_DATA = 0x15;
+
+//! Header of a DATA submessage without inline QoS, up to its serialized payload
+constexpr uint32_t DATA_HEADER_SIZE = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 20;
+
+} // namespace
+
+class TestEndpoint : public Endpoint
+{
+public:
+
+    TestEndpoint(
+            const GUID_t& guid)
+        : Endpoint(nullptr, guid, EndpointAttributes())
+    {
+    }
+
+};
+
+//! Sender keeping a copy of every datagram
+class TestSender : public RTPSMessageSenderInterface
+{
+public:
+
+    struct Submessage
+    {
+        octet id;
+        const octet* body;
+        uint16_t length;
+    };
+
+    TestSender(
+            const GUID_t& reader_guid)
+    {
+        remote_guids_.push_back(reader_guid);
+        remote_participants_.push_back(reader_guid.guidPrefix);
+    }
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return remote_participants_.front();
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return remote_participants_;
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return remote_guids_;
+    }
+
+    bool send(
+            CDRMessage_t* message,
+            std::chrono::steady_clock::time_point) const override
+    {
+        datagrams.emplace_back(message->buffer, message->buffer + message->length);
+        return true;
+    }
+
+    void lock() override
+    {
+    }
+
+    void unlock() override
+    {
+    }
+
+    /**
+     * Split a datagram on its submessages.
+     * @return false if the submessages do not end exactly at the end of the datagram.
+     */
+    static bool parse(
+            const std::vector<octet>& datagram,
+            std::vector<Submessage>& submessages)
+    {
+        submessages.clear();
+        size_t pos = RTPSMESSAGE_HEADER_SIZE;
+        while (pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE <= datagram.size())
+        {
+            Submessage submessage;
+            submessage.id = datagram[pos];
+            bool little_endian = 0 != (datagram[pos + 1] & 0x01);
+            submessage.length = little_endian ?
+                    static_cast<uint16_t>(datagram[pos + 2] | (datagram[pos + 3] << 8)) :
+                    static_cast<uint16_t>((datagram[pos + 2] << 8) | datagram[pos + 3]);
+            submessage.body = &datagram[pos + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE];
+            pos += RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + submessage.length;
+            submessages.push_back(submessage);
+        }
+        return pos == datagram.size();
+    }
+
+    mutable std::vector<std::vector<octet>> datagrams;
+
+private:
+
+    std::vector<GUID_t> remote_guids_;
+    std::vector<GuidPrefix_t> remote_participants_;
+};
+
+class RTPSMessageGroupTests : public Test
+{
+protected:
+
+    RTPSMessageGroupTests()
+        : participant_guid(make_guid(0x01, c_EntityId_RTPSParticipant))
+        , endpoint(make_guid(0x01, 0x103))
+        , sender(make_guid(0x02, 0x104))
+    {
+        ON_CALL(participant, getGuid()).WillByDefault(ReturnRef(participant_guid));
+#if HAVE_SECURITY
+        ON_CALL(participant, security_attributes()).WillByDefault(ReturnRef(security_attributes));
+#endif // if HAVE_SECURITY
+    }
+
+    static GUID_t make_guid(
+            octet participant_id,
+            const EntityId_t& entity_id)
+    {
+        GUID_t guid;
+        guid.guidPrefix.value[0] = participant_id;
+        guid.entityId = entity_id;
+        return guid;
+    }
+
+    static void fill_change(
+            CacheChange_t& change,
+            uint32_t sequence_number,
+            uint32_t length)
+    {
+        change.kind = ALIVE;
+        change.sequenceNumber = SequenceNumber_t(0, sequence_number);
+        change.serializedPayload.length = length;
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            change.serializedPayload.data[i] = static_cast<octet>(i + sequence_number);
+        }
+    }
+
+    //! Check a datagram carries only the given change, addressed to the reader
+    void check_datagram(
+            const std::vector<octet>& datagram,
+            const CacheChange_t& change)
+    {
+        std::vector<TestSender::Submessage> submessages;
+        ASSERT_TRUE(TestSender::parse(datagram, submessages));
+
+        std::vector<octet> ids;
+        const TestSender::Submessage* data = nullptr;
+        for (const TestSender::Submessage& submessage : submessages)
+        {
+            ids.push_back(submessage.id);
+            if (SUBMSG_DATA == submessage.id)
+            {
+                data = &submessage;
+            }
+        }
+        ASSERT_GE(ids.size(), 3u);
+        EXPECT_EQ(SUBMSG_INFO_DST, ids[0]);
+        EXPECT_EQ(SUBMSG_INFO_TS, ids[1]);
+        EXPECT_EQ(SUBMSG_DATA, ids[2]);
+        EXPECT_EQ(0, std::memcmp(submessages[0].body, sender.destination_guid_prefix().value,
+                sizeof(GuidPrefix_t::value)));
+
+        ASSERT_NE(nullptr, data);
+        ASSERT_EQ(DATA_HEADER_SIZE - RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + change.serializedPayload.length,
+                data->length);
+        EXPECT_EQ(0, std::memcmp(change.serializedPayload.data,
+                data->body + DATA_HEADER_SIZE - RTPSMESSAGE_SUBMESSAGEHEADER_SIZE,
+                change.serializedPayload.length));
+    }
+
+    NiceMock<RTPSParticipantImpl> participant;
+    GUID_t participant_guid;
+#if HAVE_SECURITY
+    security::ParticipantSecurityAttributes security_attributes;
+#endif // if HAVE_SECURITY
+    TestEndpoint endpoint;
+    TestSender sender;
+};
+
+/*!
+ * Two DATA submessages that do not fit together on a message.
+ * The second one fails while its payload is being serialized directly on the message. Its partial bytes should be
+ * discarded before the message is sent, and it should be serialized again on a new message.
+ */
+TEST_F(RTPSMessageGroupTests, add_data_overflow_mid_submessage)
+{
+    // Both payloads fit on a message, but not together
+    const uint32_t payload_size = 40000u;
+    CacheChange_t first(payload_size);
+    fill_change(first, 1, payload_size);
+    CacheChange_t second(payload_size);
+    fill_change(second, 2, payload_size);
+
+    {
+        RTPSMessageGroup group(&participant, &endpoint, &sender,
+                std::chrono::steady_clock::now() + std::chrono::hours(24));
+        ASSERT_TRUE(group.add_data(first, false));
+        EXPECT_TRUE(sender.datagrams.empty());
+        ASSERT_TRUE(group.add_data(second, false));
+
+        // The first message was sent when the second change did not fit
+        ASSERT_EQ(1u, sender.datagrams.size());
+    }
+
+    ASSERT_EQ(2u, sender.datagrams.size());
+    check_datagram(sender.datagrams[0], first);
+    check_datagram(sender.datagrams[1], second);
+}
+
+/*!
+ * A DATA submessage that does not fit even on an empty message.
+ * Nothing should be sent, and the group should be able to send further changes.
+ */
+TEST_F(RTPSMessageGroupTests, add_data_too_big)
+{
+    const uint32_t payload_size = participant.getMaxMessageSize() + 4;
+    CacheChange_t too_big(payload_size);
+    fill_change(too_big, 1, payload_size);
+    CacheChange_t small(64);
+    fill_change(small, 2, 64);
+
+    {
+        RTPSMessageGroup group(&participant, &endpoint, &sender,
+                std::chrono::steady_clock::now() + std::chrono::hours(24));
+        EXPECT_FALSE(group.add_data(too_big, false));
+        EXPECT_TRUE(sender.datagrams.empty());
+        ASSERT_TRUE(group.add_data(small, false));
+    }
+
+    ASSERT_EQ(1u, sender.datagrams.size());
+    check_datagram(sender.datagrams[0], small);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
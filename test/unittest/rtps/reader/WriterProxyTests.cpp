@@ -19,7 +19,9 @@
     FRIEND_TEST(WriterProxyTests, MissingChangesUpdate); \
     FRIEND_TEST(WriterProxyTests, LostChangesUpdate); \
     FRIEND_TEST(WriterProxyTests, ReceivedChangeSet); \
-    FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet);
+    FRIEND_TEST(WriterProxyTests, IrrelevantChangeSet); \
+    FRIEND_TEST(WriterProxyTests, FragmentedChanges); \
+    FRIEND_TEST(WriterProxyTests, FragmentedChangesLimit);
 
 #include <rtps/reader/WriterProxy.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
@@ -745,6 +747,106 @@ TEST(WriterProxyTests, IrrelevantChangeSet)
     ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 9)), 0u);
 }
 
+TEST(WriterProxyTests, FragmentedChanges)
+{
+    WriterProxyData wattr(4u, 1u);
+    StatefulReader readerMock;
+    EXPECT_CALL(readerMock, getEventResource()).Times(1u);
+    WriterProxy wproxy(&readerMock, RemoteLocatorsAllocationAttributes(), ResourceLimitedContainerConfig());
+    EXPECT_CALL(*wproxy.initial_acknack_, update_interval(readerMock.getTimes().initialAcknackDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, update_interval(readerMock.getTimes().heartbeatResponseDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.initial_acknack_, restart_timer()).Times(1u);
+    wproxy.start(wattr, SequenceNumber_t());
+
+    constexpr uint32_t num_changes = 3u;
+    std::vector<std::unique_ptr<CacheChange_t>> changes;
+    for (uint32_t i = 0; i < num_changes; ++i)
+    {
+        changes.emplace_back(new CacheChange_t(1000u));
+        changes.back()->sequenceNumber = SequenceNumber_t(0, i + 1);
+        changes.back()->serializedPayload.length = 1000u;
+        changes.back()->setFragmentSize(100u, true);
+    }
+
+    // 1. No fragmented changes initially
+    ASSERT_FALSE(wproxy.has_fragmented_changes());
+    ASSERT_EQ(nullptr, wproxy.find_fragmented_change(SequenceNumber_t(0, 1)));
+
+    // 2. Register changes out of order
+    ASSERT_TRUE(wproxy.add_fragmented_change(changes[2].get()));
+    ASSERT_TRUE(wproxy.add_fragmented_change(changes[0].get()));
+    ASSERT_TRUE(wproxy.add_fragmented_change(changes[1].get()));
+    ASSERT_TRUE(wproxy.has_fragmented_changes());
+    for (uint32_t i = 0; i < num_changes; ++i)
+    {
+        ASSERT_EQ(changes[i].get(), wproxy.find_fragmented_change(SequenceNumber_t(0, i + 1)));
+    }
+    ASSERT_EQ(nullptr, wproxy.find_fragmented_change(SequenceNumber_t(0, 4)));
+
+    // 3. Unregister the one in the middle
+    wproxy.remove_fragmented_change(changes[1].get());
+    ASSERT_EQ(changes[0].get(), wproxy.find_fragmented_change(SequenceNumber_t(0, 1)));
+    ASSERT_EQ(nullptr, wproxy.find_fragmented_change(SequenceNumber_t(0, 2)));
+    ASSERT_EQ(changes[2].get(), wproxy.find_fragmented_change(SequenceNumber_t(0, 3)));
+
+    // 4. Unregistering a change not being tracked does nothing
+    wproxy.remove_fragmented_change(changes[1].get());
+    ASSERT_TRUE(wproxy.has_fragmented_changes());
+
+    // 5. Stopping the proxy forgets all fragmented changes
+    EXPECT_CALL(*wproxy.initial_acknack_, cancel_timer()).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, cancel_timer()).Times(1u);
+    wproxy.stop();
+    ASSERT_FALSE(wproxy.has_fragmented_changes());
+}
+
+TEST(WriterProxyTests, FragmentedChangesLimit)
+{
+    WriterProxyData wattr(4u, 1u);
+    StatefulReader readerMock;
+    EXPECT_CALL(readerMock, getEventResource()).Times(1u);
+    WriterProxy wproxy(&readerMock, RemoteLocatorsAllocationAttributes(),
+            ResourceLimitedContainerConfig::fixed_size_configuration(2u));
+    EXPECT_CALL(*wproxy.initial_acknack_, update_interval(readerMock.getTimes().initialAcknackDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, update_interval(readerMock.getTimes().heartbeatResponseDelay)).Times(1u);
+    EXPECT_CALL(*wproxy.initial_acknack_, restart_timer()).Times(1u);
+    wproxy.start(wattr, SequenceNumber_t());
+
+    constexpr uint32_t num_changes = 3u;
+    std::vector<std::unique_ptr<CacheChange_t>> changes;
+    for (uint32_t i = 0; i < num_changes; ++i)
+    {
+        changes.emplace_back(new CacheChange_t(1000u));
+        changes.back()->sequenceNumber = SequenceNumber_t(0, i + 1);
+        changes.back()->serializedPayload.length = 1000u;
+        changes.back()->setFragmentSize(100u, true);
+    }
+
+    // 1. Changes are registered up to the limit
+    ASSERT_TRUE(wproxy.can_add_fragmented_change());
+    ASSERT_TRUE(wproxy.add_fragmented_change(changes[0].get()));
+    ASSERT_TRUE(wproxy.can_add_fragmented_change());
+    ASSERT_TRUE(wproxy.add_fragmented_change(changes[1].get()));
+
+    // 2. Registration fails once the limit is reached, and the change is not tracked
+    ASSERT_FALSE(wproxy.can_add_fragmented_change());
+    ASSERT_FALSE(wproxy.add_fragmented_change(changes[2].get()));
+    ASSERT_EQ(nullptr, wproxy.find_fragmented_change(SequenceNumber_t(0, 3)));
+    ASSERT_EQ(changes[0].get(), wproxy.find_fragmented_change(SequenceNumber_t(0, 1)));
+    ASSERT_EQ(changes[1].get(), wproxy.find_fragmented_change(SequenceNumber_t(0, 2)));
+
+    // 3. Room is made when a change is unregistered
+    wproxy.remove_fragmented_change(changes[0].get());
+    ASSERT_TRUE(wproxy.can_add_fragmented_change());
+    ASSERT_TRUE(wproxy.add_fragmented_change(changes[2].get()));
+    ASSERT_FALSE(wproxy.can_add_fragmented_change());
+    ASSERT_EQ(changes[2].get(), wproxy.find_fragmented_change(SequenceNumber_t(0, 3)));
+
+    EXPECT_CALL(*wproxy.initial_acknack_, cancel_timer()).Times(1u);
+    EXPECT_CALL(*wproxy.heartbeat_response_, cancel_timer()).Times(1u);
+    wproxy.stop();
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -503,6 +503,53 @@ TEST(TimedEvent, Event_UnregisterEventWithinCallbackOfAnotherEvent)
 
 }
 
+/*!
+ * @fn TEST(TimedEvent, Event_SharedResourceEvent)
+ * @brief This test checks the timers of several ResourceEvent objects processed by a shared one.
+ * Stopping one of them cancels its timers, even the auto-restarted ones, while the timers of the others are still
+ * triggered by the shared thread. Objects sharing the thread are created and destroyed several times.
+ */
+TEST(TimedEvent, Event_SharedResourceEvent)
+{
+    using eprosima::fastrtps::rtps::ResourceEvent;
+
+    auto shared_service = std::make_shared<ResourceEvent>();
+    shared_service->init_thread();
+
+    ResourceEvent remaining_service;
+    remaining_service.init_shared(shared_service);
+    MockEvent remaining_event(remaining_service, 10, true);
+    remaining_event.event().restart_timer();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        ResourceEvent stopped_service;
+        stopped_service.init_shared(shared_service);
+        {
+            MockEvent periodic_event(stopped_service, 10, true);
+            MockEvent single_event(stopped_service, 10, false);
+            periodic_event.event().restart_timer();
+            periodic_event.wait();
+            periodic_event.wait();
+
+            stopped_service.stop_thread();
+            int successed = periodic_event.successed_.load();
+
+            // Timers of a stopped object cannot be started again
+            single_event.event().restart_timer();
+            ASSERT_FALSE(single_event.wait(50));
+            ASSERT_EQ(successed, periodic_event.successed_.load());
+        }
+    }
+
+    // The timers of the object still running keep being triggered
+    int successed = remaining_event.successed_.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_LT(successed, remaining_event.successed_.load());
+
+    remaining_service.stop_thread();
+}
+
 int main(
         int argc,
         char** argv)
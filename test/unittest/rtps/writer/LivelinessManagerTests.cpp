@@ -478,6 +478,47 @@ TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+//! Tests that manual by topic writers are tracked correctly when writers with shorter lease durations are asserted
+//! after the timer owner, and when removing a writer moves another one within the collection
+TEST_F(LivelinessManagerTests, TimerOwnerManualByTopicReordered)
+{
+    LivelinessManager liveliness_manager(
+                std::bind(&LivelinessManagerTests::liveliness_changed,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2,
+                          std::placeholders::_3,
+                          std::placeholders::_4,
+                          std::placeholders::_5),
+                service_);
+
+
+    GuidPrefix_t guidP;
+    guidP.value[0] = 1;
+
+    liveliness_manager.add_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(1));
+    liveliness_manager.add_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1));
+    liveliness_manager.add_writer(GUID_t(guidP, 3), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.3));
+
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(1));
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1));
+    liveliness_manager.assert_liveliness(GUID_t(guidP, 3), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.3));
+    wait_liveliness_recovered(3u);
+
+    // Removing the first writer moves the last one to its position
+    EXPECT_TRUE(liveliness_manager.remove_writer(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(1)));
+    EXPECT_FALSE(liveliness_manager.assert_liveliness(GUID_t(guidP, 1), MANUAL_BY_TOPIC_LIVELINESS_QOS,
+            Duration_t(1)));
+
+    wait_liveliness_lost(1u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 2));
+    EXPECT_EQ(num_writers_lost, 1u);
+
+    wait_liveliness_lost(2u);
+    EXPECT_EQ(writer_losing_liveliness, GUID_t(guidP, 3));
+    EXPECT_EQ(num_writers_lost, 2u);
+}
+
 }
 }
 
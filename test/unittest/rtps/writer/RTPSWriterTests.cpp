@@ -16,9 +16,14 @@
 #include <gtest/gtest.h>
 
 #include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
+#include <fastdds/rtps/builtin/data/WriterProxyData.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/StatefulWriter.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/rtps/history/WriterHistory.h>
 
 
@@ -171,6 +176,83 @@ TEST(RTPSWriterTests, WriterWithCustomPayloadPool_DoesNotInitializePool_WhenDyna
     pool_initialization_test(DYNAMIC_REUSABLE_MEMORY_MODE);
 }
 
+/**
+ * Intraprocess delivery to a reliable reader.
+ * The writer should only send an intraprocess heartbeat after a sample when something is still pending for the
+ * reader, i.e. when the sample could not be delivered.
+ */
+TEST(RTPSWriterTests, IntraprocessHeartbeatOnlyWhenPending)
+{
+    RTPSParticipantAttributes p_attr;
+    p_attr.builtin.discovery_config.discoveryProtocol = DiscoveryProtocol::NONE;
+    p_attr.builtin.use_WriterLivelinessProtocol = false;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, true, p_attr);
+    ASSERT_NE(participant, nullptr);
+
+    HistoryAttributes w_hist_attr;
+    w_hist_attr.memoryPolicy = PREALLOCATED_MEMORY_MODE;
+    w_hist_attr.payloadMaxSize = TestDataType::data_size;
+    WriterHistory* writer_history = new WriterHistory(w_hist_attr);
+
+    WriterAttributes w_attr;
+    w_attr.endpoint.reliabilityKind = RELIABLE;
+    // Keep periodic heartbeats out of the way
+    w_attr.times.heartbeatPeriod = Duration_t(3600, 0);
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, w_attr, writer_history);
+    ASSERT_NE(writer, nullptr);
+    StatefulWriter* stateful_writer = dynamic_cast<StatefulWriter*>(writer);
+    ASSERT_NE(stateful_writer, nullptr);
+
+    // The reader only has room for one sample, so the second one will be rejected
+    HistoryAttributes r_hist_attr;
+    r_hist_attr.memoryPolicy = PREALLOCATED_MEMORY_MODE;
+    r_hist_attr.payloadMaxSize = TestDataType::data_size;
+    r_hist_attr.initialReservedCaches = 1;
+    r_hist_attr.maximumReservedCaches = 1;
+    ReaderHistory* reader_history = new ReaderHistory(r_hist_attr);
+
+    ReaderAttributes r_attr;
+    r_attr.endpoint.reliabilityKind = RELIABLE;
+    RTPSReader* reader = RTPSDomain::createRTPSReader(participant, r_attr, reader_history);
+    ASSERT_NE(reader, nullptr);
+
+    ReaderProxyData r_data(1u, 1u);
+    r_data.guid(reader->getGuid());
+    r_data.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    ASSERT_TRUE(writer->matched_reader_add(r_data));
+
+    WriterProxyData w_data(1u, 1u);
+    w_data.guid(writer->getGuid());
+    w_data.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    ASSERT_TRUE(reader->matched_writer_add(w_data));
+
+    TestDataType data;
+
+    // Delivered sample: nothing pending, so no heartbeat
+    Count_t heartbeat_count = stateful_writer->getHeartbeatCount();
+    CacheChange_t* ch = writer->new_change(data, ALIVE);
+    ASSERT_NE(ch, nullptr);
+    ch->serializedPayload.length = TestDataType::data_size;
+    ASSERT_TRUE(writer_history->add_change(ch));
+    EXPECT_EQ(1u, reader_history->getHistorySize());
+    EXPECT_EQ(heartbeat_count, stateful_writer->getHeartbeatCount());
+
+    // Rejected sample: still pending, so the reader gets a heartbeat
+    heartbeat_count = stateful_writer->getHeartbeatCount();
+    ch = writer->new_change(data, ALIVE);
+    ASSERT_NE(ch, nullptr);
+    ch->serializedPayload.length = TestDataType::data_size;
+    ASSERT_TRUE(writer_history->add_change(ch));
+    EXPECT_EQ(1u, reader_history->getHistorySize());
+    EXPECT_LT(heartbeat_count, stateful_writer->getHeartbeatCount());
+
+    RTPSDomain::removeRTPSReader(reader);
+    RTPSDomain::removeRTPSWriter(writer);
+    RTPSDomain::removeRTPSParticipant(participant);
+    delete(reader_history);
+    delete(writer_history);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
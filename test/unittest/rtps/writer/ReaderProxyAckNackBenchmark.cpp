@@ -0,0 +1,130 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderProxyAckNackBenchmark.cpp
+ *
+ * Measures the cost of processing the NACK bitmap of an ACKNACK on a ReaderProxy, for different bitmap densities.
+ * Every ACKNACK requests changes on a 256 bits bitmap over a window of unacknowledged changes.
+ *
+ * Usage: ReaderProxyAckNackBenchmark [iterations]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <fastrtps/rtps/writer/ReaderProxy.h>
+#include <fastrtps/rtps/writer/StatefulWriter.h>
+#include <rtps/messages/RTPSGapBuilder.hpp>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr uint32_t window_size = 1024;
+static constexpr uint32_t bitmap_bits = 256;
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t iterations = 10000;
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+    if (0 == iterations)
+    {
+        std::cerr << "Usage: " << argv[0] << " [iterations]" << std::endl;
+        return 1;
+    }
+
+    // The mocks are only used to build the proxy
+    testing::FLAGS_gmock_verbose = "error";
+
+    StatefulWriter writer;
+    WriterTimes times;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy proxy(times, alloc, &writer);
+    RTPSMessageGroup message_group(nullptr, false);
+    RTPSGapBuilder gap_builder(message_group);
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    proxy.start(reader_attributes);
+
+    std::vector<CacheChange_t> changes(window_size);
+    for (uint32_t i = 0; i < window_size; ++i)
+    {
+        changes[i].sequenceNumber = {0, 1 + i};
+        ChangeForReader_t change_for_reader(&changes[i]);
+        change_for_reader.setStatus(UNACKNOWLEDGED);
+        proxy.add_change(change_for_reader, true, false);
+    }
+
+    std::mt19937 generator(0);
+    std::cout << "density  requested  ns/acknack  ns/requested" << std::endl;
+    for (uint32_t density = 1; density <= 8; ++density)
+    {
+        // Random bitmaps where each bit is set with probability density / 8, in bursts as after a loss
+        std::vector<SequenceNumberSet_t> bitmaps;
+        for (uint32_t b = 0; b < 64; ++b)
+        {
+            SequenceNumber_t base(0, 1 + (generator() % (window_size - bitmap_bits)));
+            SequenceNumberSet_t set(base);
+            uint32_t bit = 0;
+            while (bit < bitmap_bits)
+            {
+                uint32_t burst = 1 + generator() % 16;
+                if (generator() % 8 < density)
+                {
+                    set.add_range(base + bit, base + std::min(bit + burst, bitmap_bits));
+                }
+                bit += burst;
+            }
+            bitmaps.push_back(set);
+        }
+
+        Clock::duration elapsed{0};
+        uint64_t requested = 0;
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            const SequenceNumberSet_t& set = bitmaps[i % bitmaps.size()];
+
+            Clock::time_point start = Clock::now();
+            proxy.requested_changes_set(set, gap_builder, SequenceNumber_t(0, 1));
+            elapsed += Clock::now() - start;
+
+            // Restore the changes to unacknowledged, out of the measurement
+            requested += proxy.perform_acknack_response(nullptr);
+            set.for_each([&proxy](const SequenceNumber_t& seq)
+                    {
+                        proxy.from_unsent_to_status(seq, UNACKNOWLEDGED, false);
+                    });
+        }
+
+        uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        std::cout << density << "/8      " << requested / iterations << "        " << ns / iterations << "          "
+                  << (0 < requested ? ns / requested : 0) << std::endl;
+    }
+
+    return 0;
+}
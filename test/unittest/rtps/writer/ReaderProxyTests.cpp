@@ -150,6 +150,51 @@ TEST(ReaderProxyTests, requested_changes_set_test)
 }
 #endif // __QNXNTO__
 
+TEST(ReaderProxyTests, requested_changes_set_runs_test)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    RTPSMessageGroup message_group(nullptr, false);
+    RTPSGapBuilder gap_builder(message_group);
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    rproxy.start(reader_attributes);
+
+    // Changes 10 to 80, where 40 is not relevant
+    std::vector<CacheChange_t> changes(71);
+    for (uint32_t i = 0; i < changes.size(); ++i)
+    {
+        changes[i].sequenceNumber = {0, 10 + i};
+        ChangeForReader_t change_for_reader(&changes[i]);
+        change_for_reader.setStatus(UNACKNOWLEDGED);
+        rproxy.add_change(change_for_reader, 40 != 10 + i, false);
+    }
+    rproxy.acked_changes_set({0, 20});
+    ASSERT_EQ(SequenceNumber_t(0, 19), rproxy.changes_low_mark());
+
+    // Runs that start before the window, cross the bitmap words and end after the window
+    SequenceNumberSet_t set({0, 15});
+    set.add_range({0, 15}, {0, 50});
+    set.add_range({0, 51}, {0, 101});
+
+    EXPECT_CALL(gap_builder, add(testing::_)).Times(20).WillRepeatedly(testing::Return(true));
+    EXPECT_CALL(gap_builder, add(SequenceNumber_t(0, 40))).Times(1).WillOnce(testing::Return(true));
+
+    ASSERT_TRUE(rproxy.requested_changes_set(set, gap_builder, {0, 10}));
+    ASSERT_TRUE(rproxy.has_unacknowledged(SequenceNumber_t()));
+
+    // 20 to 80, except 40 and 50
+    ASSERT_EQ(59u, rproxy.perform_acknack_response(nullptr));
+
+    // Requesting them again does nothing, as they are no longer unacknowledged
+    SequenceNumberSet_t again({0, 20});
+    again.add_range({0, 20}, {0, 40});
+    ASSERT_FALSE(rproxy.requested_changes_set(again, gap_builder, {0, 10}));
+}
+
 FragmentNumber_t mark_next_fragment_sent(
         ReaderProxy& rproxy,
         SequenceNumber_t sequence_number,
@@ -333,6 +378,54 @@ TEST(ReaderProxyTests, process_nack_frag_multiple_fragments_different_windows_te
             TOTAL_NUMBER_OF_FRAGMENTS + 1u), TOTAL_NUMBER_OF_FRAGMENTS + 1u);
 }
 
+TEST(ReaderProxyTests, process_nack_frag_underway_fragments_test)
+{
+    constexpr FragmentNumber_t TOTAL_NUMBER_OF_FRAGMENTS = 10;
+    constexpr uint16_t FRAGMENT_SIZE = 100;
+
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    CacheChange_t seq;
+    seq.sequenceNumber = {0, 1};
+    seq.serializedPayload.length = TOTAL_NUMBER_OF_FRAGMENTS * FRAGMENT_SIZE;
+    seq.setFragmentSize(FRAGMENT_SIZE);
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    rproxy.start(reader_attributes);
+
+    ChangeForReader_t change(&seq);
+    rproxy.add_change(change, true, false);
+
+    // Deliver all fragments once.
+    for (auto i = 1u; i <= TOTAL_NUMBER_OF_FRAGMENTS; ++i)
+    {
+        ASSERT_EQ(mark_next_fragment_sent(rproxy, seq.sequenceNumber, i), i);
+    }
+    rproxy.from_unsent_to_status(seq.sequenceNumber, UNDERWAY, false, true);
+
+    constexpr FragmentNumber_t UNDELIVERED_FRAGMENT = 3;
+    FragmentNumberSet_t undelivered_fragment_set(UNDELIVERED_FRAGMENT);
+    undelivered_fragment_set.add(UNDELIVERED_FRAGMENT);
+
+    // First NACK_FRAG is accepted and the fragment is resent.
+    ASSERT_TRUE(rproxy.process_nack_frag({}, 1, seq.sequenceNumber, undelivered_fragment_set));
+    rproxy.perform_acknack_response(nullptr);
+    ASSERT_EQ(mark_next_fragment_sent(rproxy, seq.sequenceNumber, UNDELIVERED_FRAGMENT), UNDELIVERED_FRAGMENT);
+    rproxy.from_unsent_to_status(seq.sequenceNumber, UNDERWAY, false, true);
+
+    // A NACK_FRAG crossing the retransmission on the wire is ignored.
+    ASSERT_FALSE(rproxy.process_nack_frag({}, 2, seq.sequenceNumber, undelivered_fragment_set));
+
+    // Once the nack supression period expires, the fragment can be requested again.
+    ASSERT_TRUE(rproxy.perform_nack_supression());
+    ASSERT_TRUE(rproxy.process_nack_frag({}, 3, seq.sequenceNumber, undelivered_fragment_set));
+    rproxy.perform_acknack_response(nullptr);
+    ASSERT_EQ(mark_next_fragment_sent(rproxy, seq.sequenceNumber, UNDELIVERED_FRAGMENT), UNDELIVERED_FRAGMENT);
+}
+
 TEST(ReaderProxyTests, has_been_delivered_test)
 {
     StatefulWriter writer_mock;
@@ -382,6 +475,93 @@ TEST(ReaderProxyTests, has_been_delivered_test)
     expect_result({0, 3}, false, false);
 }
 
+TEST(ReaderProxyTests, acknowledgement_generation_test)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    CacheChange_t seq1; seq1.sequenceNumber = {0, 1};
+    CacheChange_t seq2; seq2.sequenceNumber = {0, 2};
+    CacheChange_t seq3; seq3.sequenceNumber = {0, 3};
+
+    rproxy.add_change(ChangeForReader_t(&seq1), true, false);
+    rproxy.add_change(ChangeForReader_t(&seq2), true, false);
+    rproxy.add_change(ChangeForReader_t(&seq3), true, false);
+
+    uint64_t generation = writerMock.acknowledgement_generation();
+
+    // Acknowledging new changes moves the generation
+    rproxy.acked_changes_set(SequenceNumber_t(0, 2));
+    ASSERT_EQ(generation + 1, writerMock.acknowledgement_generation());
+
+    // Repeated acknowledgements do not
+    rproxy.acked_changes_set(SequenceNumber_t(0, 2));
+    rproxy.acked_changes_set(SequenceNumber_t(0, 1));
+    ASSERT_EQ(generation + 1, writerMock.acknowledgement_generation());
+
+    rproxy.acked_changes_set(SequenceNumber_t(0, 4));
+    ASSERT_EQ(generation + 2, writerMock.acknowledgement_generation());
+}
+
+TEST(ReaderProxyTests, acknack_response_takes_changes_from_history_test)
+{
+    StatefulWriter writerMock;
+    WriterTimes wTimes;
+    RemoteLocatorsAllocationAttributes alloc;
+    ReaderProxy rproxy(wTimes, alloc, &writerMock);
+    CacheChange_t seq1; seq1.sequenceNumber = {0, 1};
+    CacheChange_t seq2; seq2.sequenceNumber = {0, 2};
+    CacheChange_t seq3; seq3.sequenceNumber = {0, 3};
+    CacheChange_t seq4; seq4.sequenceNumber = {0, 4};
+    RTPSMessageGroup message_group(nullptr, false);
+    RTPSGapBuilder gap_builder(message_group);
+
+    ReaderProxyData reader_attributes(0, 0);
+    reader_attributes.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    rproxy.start(reader_attributes);
+
+    // The proxy does not keep the changes, it takes them from the writer's history
+    for (CacheChange_t* change : {&seq1, &seq2, &seq3, &seq4})
+    {
+        writerMock.history()->m_changes.push_back(change);
+        ChangeForReader_t change_for_reader(change);
+        change_for_reader.setStatus(UNACKNOWLEDGED);
+        rproxy.add_change(change_for_reader, &seq3 != change, false);
+    }
+    ASSERT_TRUE(rproxy.has_changes());
+    ASSERT_TRUE(rproxy.has_unacknowledged(SequenceNumber_t()));
+
+    SequenceNumberSet_t set({0, 1});
+    set.add({0, 1});
+    set.add({0, 2});
+    set.add({0, 4});
+    ASSERT_TRUE(rproxy.requested_changes_set(set, gap_builder, seq1.sequenceNumber));
+    ASSERT_FALSE(rproxy.has_unacknowledged(SequenceNumber_t()));
+
+    std::vector<CacheChange_t*> resent;
+    ASSERT_EQ(3u, rproxy.perform_acknack_response([&resent](CacheChange_t* change)
+            {
+                resent.push_back(change);
+            }));
+    ASSERT_EQ((std::vector<CacheChange_t*>{&seq1, &seq2, &seq4}), resent);
+
+    // Nothing else to resend
+    ASSERT_EQ(0u, rproxy.perform_acknack_response(nullptr));
+
+    // Removing a change leaves a hole, which stops the low mark
+    rproxy.change_has_been_removed(seq2.sequenceNumber);
+    ASSERT_TRUE(rproxy.change_is_acked(seq2.sequenceNumber));
+    rproxy.from_unsent_to_status(seq1.sequenceNumber, ACKNOWLEDGED, false);
+    ASSERT_EQ(seq1.sequenceNumber, rproxy.changes_low_mark());
+    ASSERT_FALSE(rproxy.change_is_acked(seq4.sequenceNumber));
+    ASSERT_TRUE(rproxy.has_changes());
+
+    rproxy.acked_changes_set(seq4.sequenceNumber + 1);
+    ASSERT_EQ(seq4.sequenceNumber, rproxy.changes_low_mark());
+    ASSERT_FALSE(rproxy.has_changes());
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -0,0 +1,164 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <deque>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <fastrtps/utils/collections/RingBuffer.hpp>
+
+using namespace eprosima::fastrtps;
+
+TEST(RingBufferTests, push_pop_both_ends)
+{
+    RingBuffer<int> uut;
+    uut.reserve(4);
+    ASSERT_EQ(uut.capacity(), 4u);
+    ASSERT_TRUE(uut.empty());
+
+    uut.push_back(2);
+    uut.push_back(3);
+    uut.push_front(1);
+    uut.push_front(0);
+    ASSERT_EQ(uut.size(), 4u);
+    ASSERT_EQ(uut.capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(uut[static_cast<size_t>(i)], i);
+    }
+
+    // Growing keeps the order
+    uut.push_back(4);
+    ASSERT_EQ(uut.capacity(), 8u);
+    EXPECT_TRUE(std::is_sorted(uut.begin(), uut.end()));
+    EXPECT_EQ(uut.front(), 0);
+    EXPECT_EQ(uut.back(), 4);
+
+    uut.pop_front();
+    uut.pop_back();
+    EXPECT_EQ(uut.front(), 1);
+    EXPECT_EQ(uut.back(), 3);
+    EXPECT_EQ(uut.size(), 3u);
+    EXPECT_THROW(uut.at(3), std::out_of_range);
+
+    uut.clear();
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(uut.begin(), uut.end());
+}
+
+TEST(RingBufferTests, iterators_survive_front_removal)
+{
+    RingBuffer<int> uut;
+    for (int i = 0; i < 10; ++i)
+    {
+        uut.push_back(i);
+    }
+
+    RingBuffer<int>::iterator it = uut.begin() + 5;
+    RingBuffer<int>::iterator next = uut.erase(uut.begin());
+    EXPECT_EQ(next, uut.begin());
+    EXPECT_EQ(*next, 1);
+    EXPECT_EQ(*it, 5);
+
+    // Erasing after an iterator keeps it valid, and returns the following element
+    RingBuffer<int>::const_iterator cit = it;
+    next = uut.erase(it + 1);
+    EXPECT_EQ(*cit, 5);
+    EXPECT_EQ(*next, 7);
+    EXPECT_EQ(next - cit, 1);
+    EXPECT_EQ(std::distance(uut.rbegin(), uut.rend()), 8);
+}
+
+TEST(RingBufferTests, behaves_like_deque)
+{
+    std::mt19937 rng(1234);
+
+    for (int round = 0; round < 50; ++round)
+    {
+        RingBuffer<int> uut;
+        std::deque<int> expected;
+
+        for (int op = 0; op < 1000; ++op)
+        {
+            int value = static_cast<int>(rng() % 1000);
+            switch (rng() % 6)
+            {
+                case 0:
+                    uut.push_back(value);
+                    expected.push_back(value);
+                    break;
+
+                case 1:
+                    uut.push_front(value);
+                    expected.push_front(value);
+                    break;
+
+                case 2:
+                    if (!expected.empty())
+                    {
+                        uut.pop_front();
+                        expected.pop_front();
+                    }
+                    break;
+
+                case 3:
+                {
+                    size_t pos = rng() % (expected.size() + 1);
+                    auto it = uut.insert(uut.cbegin() + pos, value);
+                    expected.insert(expected.begin() + pos, value);
+                    EXPECT_EQ(*it, value);
+                    break;
+                }
+
+                case 4:
+                    if (!expected.empty())
+                    {
+                        size_t pos = rng() % expected.size();
+                        auto it = uut.erase(uut.cbegin() + pos);
+                        auto expected_it = expected.erase(expected.begin() + pos);
+                        ASSERT_EQ(it - uut.begin(), expected_it - expected.begin());
+                    }
+                    break;
+
+                default:
+                    if (!expected.empty())
+                    {
+                        size_t first = rng() % expected.size();
+                        size_t last = first + rng() % (expected.size() - first + 1);
+                        uut.erase(uut.cbegin() + first, uut.cbegin() + last);
+                        expected.erase(expected.begin() + first, expected.begin() + last);
+                    }
+                    break;
+            }
+
+            ASSERT_EQ(uut.size(), expected.size());
+            ASSERT_TRUE(std::equal(uut.begin(), uut.end(), expected.begin()));
+            ASSERT_TRUE(std::equal(uut.rbegin(), uut.rend(), expected.rbegin()));
+        }
+
+        RingBuffer<int> copy(uut);
+        ASSERT_TRUE(std::equal(copy.begin(), copy.end(), expected.begin()));
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -3760,3 +3760,94 @@ TEST_F(XMLParserTests, getXMLOwnershipStrengthQos)
                 XMLParserTest::propertiesPolicy_wrapper(titleElement, ownership_strength_policy, ident));
     }
 }
+
+/*
+ * This test checks the parsing of a <thread_settings> xml element into a ThreadSettings object.
+ * 1. Correct parsing of all the child elements, with the affinity in decimal and hexadecimal.
+ * 2. Check that missing elements keep their default values.
+ * 3. Check invalid values and a wrong xml element definition.
+ */
+TEST_F(XMLParserTests, getXMLThreadSettings)
+{
+    uint8_t ident = 1;
+    tinyxml2::XMLDocument xml_doc;
+    tinyxml2::XMLElement* titleElement;
+
+    // Template xml
+    const char* xml_p =
+            "\
+            <thread_settings>\
+                <scheduling_policy>%s</scheduling_policy>\
+                <priority>%s</priority>\
+                <affinity>%s</affinity>\
+            </thread_settings>\
+            ";
+    char xml[1000];
+
+    {
+        eprosima::fastdds::rtps::ThreadSettings thread_settings;
+        sprintf(xml, xml_p, "1", "-5", "12");
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::getXMLThreadSettings_wrapper(titleElement, thread_settings, ident));
+        EXPECT_EQ(thread_settings.scheduling_policy, 1);
+        EXPECT_EQ(thread_settings.priority, -5);
+        EXPECT_EQ(thread_settings.affinity, 12u);
+
+        sprintf(xml, xml_p, "2", "10", "0xF0000000F");
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::getXMLThreadSettings_wrapper(titleElement, thread_settings, ident));
+        EXPECT_EQ(thread_settings.scheduling_policy, 2);
+        EXPECT_EQ(thread_settings.priority, 10);
+        EXPECT_EQ(thread_settings.affinity, 0xF0000000Fu);
+    }
+
+    {
+        eprosima::fastdds::rtps::ThreadSettings thread_settings;
+        const char* xml_e =
+                "\
+                <thread_settings>\
+                    <affinity>3</affinity>\
+                </thread_settings>\
+                ";
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml_e));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::getXMLThreadSettings_wrapper(titleElement, thread_settings, ident));
+        EXPECT_EQ(thread_settings.scheduling_policy, eprosima::fastdds::rtps::ThreadSettings().scheduling_policy);
+        EXPECT_EQ(thread_settings.priority, eprosima::fastdds::rtps::ThreadSettings().priority);
+        EXPECT_EQ(thread_settings.affinity, 3u);
+    }
+
+    {
+        eprosima::fastdds::rtps::ThreadSettings thread_settings;
+        std::vector<std::vector<const char*>> invalid_values {
+            {"", "1", "1"},
+            {"-2", "1", "1"},
+            {"1", "high", "1"},
+            {"1", "1", "-1"},
+            {"1", "1", "0xZZ"},
+            {"1", "1", ""}
+        };
+
+        for (const auto& values : invalid_values)
+        {
+            sprintf(xml, xml_p, values[0], values[1], values[2]);
+            ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+            titleElement = xml_doc.RootElement();
+            EXPECT_EQ(XMLP_ret::XML_ERROR,
+                    XMLParserTest::getXMLThreadSettings_wrapper(titleElement, thread_settings, ident));
+        }
+
+        const char* xml_e =
+                "\
+                <thread_settings>\
+                    <bad_element>1</bad_element>\
+                </thread_settings>\
+                ";
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml_e));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_ERROR,
+                XMLParserTest::getXMLThreadSettings_wrapper(titleElement, thread_settings, ident));
+    }
+}
@@ -1035,6 +1035,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <segment_size>262144</segment_size>\
                     <port_queue_capacity>512</port_queue_capacity>\
                     <healthy_check_timeout_ms>1000</healthy_check_timeout_ms>\
+                    <wait_spin_time_us>20</wait_spin_time_us>\
+                    <wait_yield_time_us>100</wait_yield_time_us>\
                     <rtps_dump_file>rtsp_messages.log</rtps_dump_file>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
@@ -1050,6 +1052,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pSHMDesc->segment_size(), 262144u);
         EXPECT_EQ(pSHMDesc->port_queue_capacity(), 512u);
         EXPECT_EQ(pSHMDesc->healthy_check_timeout_ms(), 1000u);
+        EXPECT_EQ(pSHMDesc->wait_spin_time_us(), 20u);
+        EXPECT_EQ(pSHMDesc->wait_yield_time_us(), 100u);
         EXPECT_EQ(pSHMDesc->rtps_dump_file(), "rtsp_messages.log");
         EXPECT_EQ(pSHMDesc->max_message_size(), 16384u);
         EXPECT_EQ(pSHMDesc->max_initial_peers_range(), 100u);
@@ -1115,6 +1119,8 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "segment_size",
         "port_queue_capacity",
         "healthy_check_timeout_ms",
+        "wait_spin_time_us",
+        "wait_yield_time_us",
         "rtps_dump_file",
         "bad_element"
     };
@@ -70,6 +70,14 @@ public:
         return getXMLDiscoverySettings(elem, settings, ident);
     }
 
+    static XMLP_ret getXMLThreadSettings_wrapper(
+            tinyxml2::XMLElement* elem,
+            eprosima::fastdds::rtps::ThreadSettings& thread_setting,
+            uint8_t ident)
+    {
+        return getXMLThreadSettings(elem, thread_setting, ident);
+    }
+
     static XMLP_ret getXMLPortParameters_wrapper(
             tinyxml2::XMLElement* elem,
             PortParameters& port,